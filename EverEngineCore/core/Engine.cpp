@@ -1,6 +1,11 @@
 #include "EverEngineCore/core/Engine.h"
 #include "EverEngineCore/core/Time.h"
 #include "EverEngineCore/platform/Window.h"
+#include "EverEngineCore/platform/filesystem/AsyncIO.h"
+#include "EverEngineCore/platform/filesystem/FileWatcher.h"
+#include "EverEngineCore/platform/filesystem/FileMetadataCache.h"
+#include "EverEngineCore/platform/filesystem/DerivedDataCache.h"
+#include "EverEngineCore/platform/filesystem/FileSystem.h"
 #include "EverEngineCore/core/Log.h"
 #include "EverEngineCore/rendering/renderer/Renderer.h"
 
@@ -9,6 +14,10 @@ Engine::Engine() {
 }
 
 Engine::~Engine() {
+    FileWatcher::shutdown();
+    FileMetadataCache::shutdown();
+    DerivedDataCache::shutdown();
+    AsyncIO::shutdown();
     LOG_INFO("ENGINE::CLOSE");
 }
 
@@ -16,6 +25,10 @@ int Engine::init(unsigned int window_width, unsigned int window_height, const ch
     m_window = std::make_unique<Window>(window_width, window_height, title);
     Time::init();
     m_input.init(m_dispatcher);
+    AsyncIO::init();
+    FileWatcher::init();
+    FileMetadataCache::init();
+    DerivedDataCache::init(Path::join(Directory::getExecutable(), "DerivedDataCache"));
     Renderer::init(m_window->getProcLoader());
     LOG_INFO("ENGINE::INIT");
     return 0;
@@ -41,6 +54,8 @@ int Engine::run()
     {  
         Time::update();
         m_dispatcher.process_event();
+        AsyncIO::dispatchCompletions();
+        FileWatcher::dispatch();
 
         on_update();
         m_window->on_update();
@@ -49,6 +64,7 @@ int Engine::run()
         Renderer::setClearColor(0.5f, 0.3f, 0.7f, 1.0f);
         Renderer::clear();
     }
+    Renderer::shutdown();
     m_window = nullptr;
 
     return 0;
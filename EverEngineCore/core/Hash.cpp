@@ -0,0 +1,104 @@
+#include "EverEngineCore/core/Hash.h"
+#include <cstring>
+
+static constexpr uint64_t k_prime1 = 11400714785074694791ull;
+static constexpr uint64_t k_prime2 = 14029467366897019727ull;
+static constexpr uint64_t k_prime3 = 1609587929392839161ull;
+static constexpr uint64_t k_prime4 = 9650029242287828579ull;
+static constexpr uint64_t k_prime5 = 2870177450012600261ull;
+
+static inline uint64_t rotl(uint64_t value, int bits)
+{
+    return (value << bits) | (value >> (64 - bits));
+}
+
+static inline uint64_t read64(const uint8_t* ptr)
+{
+    uint64_t value;
+    std::memcpy(&value, ptr, sizeof(value));
+    return value;
+}
+
+static inline uint32_t read32(const uint8_t* ptr)
+{
+    uint32_t value;
+    std::memcpy(&value, ptr, sizeof(value));
+    return value;
+}
+
+static inline uint64_t xxh_round(uint64_t acc, uint64_t input)
+{
+    acc += input * k_prime2;
+    acc = rotl(acc, 31);
+    return acc * k_prime1;
+}
+
+static inline uint64_t merge_round(uint64_t acc, uint64_t value)
+{
+    acc ^= xxh_round(0, value);
+    return acc * k_prime1 + k_prime4;
+}
+
+uint64_t Hash::xxh64(const void* data, size_t size, uint64_t seed)
+{
+    const uint8_t* ptr = static_cast<const uint8_t*>(data);
+    const uint8_t* end = ptr + size;
+    uint64_t hash;
+
+    if (size >= 32)
+    {
+        const uint8_t* limit = end - 32;
+        uint64_t v1 = seed + k_prime1 + k_prime2;
+        uint64_t v2 = seed + k_prime2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - k_prime1;
+
+        do
+        {
+            v1 = xxh_round(v1, read64(ptr));      ptr += 8;
+            v2 = xxh_round(v2, read64(ptr));      ptr += 8;
+            v3 = xxh_round(v3, read64(ptr));      ptr += 8;
+            v4 = xxh_round(v4, read64(ptr));      ptr += 8;
+        } while (ptr <= limit);
+
+        hash = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+        hash = merge_round(hash, v1);
+        hash = merge_round(hash, v2);
+        hash = merge_round(hash, v3);
+        hash = merge_round(hash, v4);
+    }
+    else
+    {
+        hash = seed + k_prime5;
+    }
+
+    hash += static_cast<uint64_t>(size);
+
+    while (ptr + 8 <= end)
+    {
+        hash ^= xxh_round(0, read64(ptr));
+        hash = rotl(hash, 27) * k_prime1 + k_prime4;
+        ptr += 8;
+    }
+
+    if (ptr + 4 <= end)
+    {
+        hash ^= static_cast<uint64_t>(read32(ptr)) * k_prime1;
+        hash = rotl(hash, 23) * k_prime2 + k_prime3;
+        ptr += 4;
+    }
+
+    while (ptr < end)
+    {
+        hash ^= (*ptr) * k_prime5;
+        hash = rotl(hash, 11) * k_prime1;
+        ptr++;
+    }
+
+    hash ^= hash >> 33;
+    hash *= k_prime2;
+    hash ^= hash >> 29;
+    hash *= k_prime3;
+    hash ^= hash >> 32;
+    return hash;
+}
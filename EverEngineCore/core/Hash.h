@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string_view>
+
+/**
+ * @class Hash
+ * @brief Набір некриптографічних хеш-функцій рушія
+ *
+ * FNV-1a обчислюється під час компіляції та використовується для коротких
+ * ключів (шляхи, імена). XXH64 призначений для хешування вмісту файлів
+ * і великих буферів.
+ *
+ * @code
+ * constexpr uint64_t key = Hash::fnv1a64("shaders/basic.vert");
+ * uint64_t content = Hash::xxh64(data.data(), data.size());
+ * @endcode
+ */
+class Hash
+{
+public:
+    /**
+     * @brief 32-бітний FNV-1a
+     * @param value Вхідні дані
+     * @return Хеш
+     */
+    static constexpr uint32_t fnv1a32(std::string_view value)
+    {
+        uint32_t hash = 2166136261u;
+        for (char c : value)
+        {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+
+    /**
+     * @brief 64-бітний FNV-1a
+     * @param value Вхідні дані
+     * @return Хеш
+     */
+    static constexpr uint64_t fnv1a64(std::string_view value)
+    {
+        uint64_t hash = 14695981039346656037ull;
+        for (char c : value)
+        {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    /**
+     * @brief 64-бітний xxHash (XXH64)
+     * @param data Вказівник на дані
+     * @param size Розмір даних у байтах
+     * @param seed Початкове значення
+     * @return Хеш
+     */
+    static uint64_t xxh64(const void* data, size_t size, uint64_t seed = 0);
+
+    /**
+     * @brief Комбінує два хеші в один
+     */
+    static constexpr uint64_t combine(uint64_t seed, uint64_t value)
+    {
+        return seed ^ (value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2));
+    }
+};
@@ -0,0 +1,131 @@
+#include "EverEngineCore/platform/filesystem/AsyncIO.h"
+#include "EverEngineCore/platform/filesystem/async/AsyncIOBackend.h"
+#include "EverEngineCore/platform/filesystem/async/IoUringBackend.h"
+#include "EverEngineCore/platform/filesystem/async/ThreadPoolBackend.h"
+#include "EverEngineCore/core/Log.h"
+
+#include <atomic>
+#include <memory>
+
+static IOQueue s_queue;
+static std::unique_ptr<AsyncIOBackend> s_backend;
+static std::atomic<IORequestId> s_nextId{ 1 };
+static std::mutex s_initMutex;
+
+bool AsyncIO::init(Backend backend, uint32_t maxInFlight, uint32_t workerCount)
+{
+    std::lock_guard<std::mutex> lock(s_initMutex);
+    if (s_backend) return true;
+
+    s_queue.reset();
+
+    if (backend != Backend::ThreadPool && IoUringBackend::isSupported())
+    {
+        s_backend = std::make_unique<IoUringBackend>();
+        if (!s_backend->start(s_queue, maxInFlight))
+        {
+            s_backend = nullptr;
+        }
+    }
+
+    if (!s_backend)
+    {
+        if (backend == Backend::IoUring)
+        {
+            LOG_ERROR("ERROR::ASYNC_IO::IO_URING_UNAVAILABLE");
+            return false;
+        }
+        s_backend = std::make_unique<ThreadPoolBackend>(workerCount);
+        s_backend->start(s_queue, maxInFlight);
+    }
+
+    LOG_INFO("ASYNC_IO::INIT->{}", s_backend->getName());
+    return true;
+}
+
+void AsyncIO::shutdown()
+{
+    std::lock_guard<std::mutex> lock(s_initMutex);
+    if (!s_backend) return;
+
+    s_queue.close();
+    s_backend->stop();
+    s_backend = nullptr;
+    s_queue.reset();
+    LOG_INFO("ASYNC_IO::SHUTDOWN");
+}
+
+IORequestId AsyncIO::submit(IOReadRequest request)
+{
+    std::vector<IOReadRequest> batch;
+    batch.push_back(std::move(request));
+    return submitBatch(std::move(batch)).front();
+}
+
+std::vector<IORequestId> AsyncIO::submitBatch(std::vector<IOReadRequest> requests)
+{
+    if (!isInitialized()) init();
+
+    std::vector<IORequestId> ids;
+    std::vector<std::shared_ptr<IOTask>> tasks;
+    ids.reserve(requests.size());
+    tasks.reserve(requests.size());
+
+    for (auto& request : requests)
+    {
+        if (request.path.empty() || (request.size > 0 && !request.buffer))
+        {
+            LOG_ERROR("ERROR::ASYNC_IO::INVALID_REQUEST->{}", request.path);
+            ids.push_back(0);
+            continue;
+        }
+        if (request.priority >= IOPriority::Count)
+        {
+            request.priority = IOPriority::Critical;
+        }
+
+        auto task = std::make_shared<IOTask>();
+        task->id = s_nextId++;
+        task->request = std::move(request);
+        ids.push_back(task->id);
+        tasks.push_back(std::move(task));
+    }
+
+    if (!tasks.empty()) s_queue.push(std::move(tasks));
+    return ids;
+}
+
+bool AsyncIO::cancel(IORequestId id)
+{
+    return id != 0 && s_queue.cancel(id);
+}
+
+size_t AsyncIO::dispatchCompletions(size_t maxCount)
+{
+    auto completed = s_queue.takeCompleted(maxCount);
+    for (auto& [task, result] : completed)
+    {
+        if (task->request.onComplete)
+        {
+            task->request.onComplete(result);
+        }
+    }
+    return completed.size();
+}
+
+size_t AsyncIO::getPendingCount()
+{
+    return s_queue.getPendingCount();
+}
+
+bool AsyncIO::isInitialized()
+{
+    std::lock_guard<std::mutex> lock(s_initMutex);
+    return s_backend != nullptr;
+}
+
+const char* AsyncIO::getBackendName()
+{
+    std::lock_guard<std::mutex> lock(s_initMutex);
+    return s_backend ? s_backend->getName() : "None";
+}
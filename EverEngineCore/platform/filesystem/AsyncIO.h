@@ -0,0 +1,156 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <functional>
+#include <cstdint>
+#include <cstddef>
+
+/// Ідентифікатор асинхронного запиту (0 - невалідний запит).
+using IORequestId = uint64_t;
+
+/**
+ * @brief Пріоритет запиту вводу/виводу.
+ *
+ * Запити з вищим пріоритетом потрапляють у бекенд раніше за всі
+ * запити з нижчим пріоритетом, що ще чекають у черзі.
+ */
+enum class IOPriority
+{
+    Low = 0,    ///< Фонове підвантаження
+    Normal,     ///< Типові запити
+    High,       ///< Ресурси, потрібні найближчими кадрами
+    Critical,   ///< Ресурси, що блокують поточний кадр
+    Count       ///< Кількість пріоритетів (для внутрішнього використання)
+};
+
+/**
+ * @brief Стан завершеного запиту.
+ */
+enum class IOStatus
+{
+    Success,    ///< Дані прочитано (bytesRead може бути меншим за size, якщо досягнуто кінця файлу)
+    Cancelled,  ///< Запит скасовано до завершення
+    Error       ///< Помилка відкриття або читання (див. IOResult::error)
+};
+
+/**
+ * @brief Результат асинхронного запиту, що передається у колбек.
+ */
+struct IOResult
+{
+    IORequestId id = 0;                 ///< Ідентифікатор запиту
+    IOStatus status = IOStatus::Error;  ///< Стан завершення
+    uint64_t bytesRead = 0;             ///< Кількість прочитаних байтів
+    int error = 0;                      ///< Код помилки ОС (errno) для IOStatus::Error
+};
+
+/**
+ * @brief Запит на читання частини файлу у буфер викликача.
+ *
+ * Буфер має залишатись валідним до виклику onComplete.
+ */
+struct IOReadRequest
+{
+    std::string path;                               ///< Шлях до файлу
+    uint64_t offset = 0;                            ///< Зміщення від початку файлу
+    uint64_t size = 0;                              ///< Кількість байтів для читання
+    void* buffer = nullptr;                         ///< Буфер призначення (мінімум size байтів)
+    IOPriority priority = IOPriority::Normal;       ///< Пріоритет запиту
+    std::function<void(const IOResult&)> onComplete; ///< Колбек, що викликається в основному потоці
+};
+
+/**
+ * @brief Підсистема асинхронного вводу/виводу.
+ *
+ * На Linux використовує io_uring, на інших платформах (або якщо ядро
+ * не підтримує io_uring) - пул потоків з pread. Запити обмежені кількістю
+ * одночасних операцій, впорядковуються за пріоритетом і можуть бути скасовані.
+ * Колбеки ніколи не викликаються з робочих потоків: вони накопичуються
+ * та виконуються у dispatchCompletions(), який Engine::run викликає
+ * один раз на кадр одразу після обробки подій.
+ *
+ * @code
+ * std::vector<uint8_t> header(64);
+ * IOReadRequest request;
+ * request.path = "assets/level.pak";
+ * request.size = header.size();
+ * request.buffer = header.data();
+ * request.onComplete = [](const IOResult& result) { ... };
+ * AsyncIO::submit(std::move(request));
+ * @endcode
+ */
+class AsyncIO
+{
+public:
+    /**
+     * @brief Тип бекенду.
+     */
+    enum class Backend
+    {
+        Auto,       ///< io_uring, якщо доступний, інакше пул потоків
+        IoUring,    ///< Лише io_uring (Linux)
+        ThreadPool  ///< Пул потоків з блокуючим pread
+    };
+
+    /**
+     * @brief Ініціалізує підсистему та запускає бекенд.
+     * @param backend Бажаний бекенд.
+     * @param maxInFlight Максимальна кількість одночасних операцій.
+     * @param workerCount Кількість потоків для пулу (0 - за кількістю ядер).
+     * @return true, якщо бекенд запущено.
+     */
+    static bool init(Backend backend = Backend::Auto, uint32_t maxInFlight = 64, uint32_t workerCount = 0);
+
+    /**
+     * @brief Зупиняє бекенд. Незавершені запити відкидаються без виклику колбеків.
+     */
+    static void shutdown();
+
+    /**
+     * @brief Додає запит на читання у чергу.
+     * @param request Опис запиту.
+     * @return Ідентифікатор запиту або 0, якщо запит невалідний.
+     */
+    static IORequestId submit(IOReadRequest request);
+
+    /**
+     * @brief Додає пакет запитів під одним блокуванням черги.
+     * @param requests Запити для додавання.
+     * @return Ідентифікатори у тому ж порядку (0 для невалідних запитів).
+     */
+    static std::vector<IORequestId> submitBatch(std::vector<IOReadRequest> requests);
+
+    /**
+     * @brief Скасовує запит.
+     *
+     * Запит, що ще чекає у черзі, знімається одразу; запит, що вже виконується,
+     * буде перерваний бекендом. В обох випадках колбек отримає IOStatus::Cancelled.
+     *
+     * @param id Ідентифікатор запиту.
+     * @return true, якщо запит ще не був завершений.
+     */
+    static bool cancel(IORequestId id);
+
+    /**
+     * @brief Викликає колбеки завершених запитів у поточному потоці.
+     * @param maxCount Максимальна кількість колбеків за виклик.
+     * @return Кількість виконаних колбеків.
+     */
+    static size_t dispatchCompletions(size_t maxCount = SIZE_MAX);
+
+    /**
+     * @brief Повертає кількість запитів, що очікують або виконуються.
+     */
+    static size_t getPendingCount();
+
+    /**
+     * @brief Перевіряє, чи ініціалізована підсистема.
+     */
+    static bool isInitialized();
+
+    /**
+     * @brief Повертає назву активного бекенду.
+     */
+    static const char* getBackendName();
+};
@@ -0,0 +1,501 @@
+#include "EverEngineCore/platform/filesystem/DerivedDataCache.h"
+#include "EverEngineCore/platform/filesystem/FileSystem.h"
+#include "EverEngineCore/platform/filesystem/VirtualFileSystem.h"
+#include "EverEngineCore/platform/Platform.h"
+#include "EverEngineCore/core/Hash.h"
+#include "EverEngineCore/core/Log.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+#ifdef PLATFORM_WINDOWS
+#include <windows.h>
+#endif
+
+namespace
+{
+    constexpr char k_entryMagic[4] = { 'E', 'D', 'D', 'E' };
+    constexpr char k_indexMagic[4] = { 'E', 'D', 'D', 'I' };
+    constexpr uint32_t k_formatVersion = 1;
+    constexpr const char* k_indexName = "index.bin";
+    constexpr const char* k_entryExtension = ".ddc";
+    constexpr std::string_view k_tempMarker = ".tmp";   ///< write_atomic: <path>.tmp<лічильник>_<потік>
+
+#ifdef PLATFORM_WINDOWS
+    constexpr uint64_t k_racyWindow = 10'000'000;  ///< 1 с в одиницях FILETIME
+#else
+    constexpr uint64_t k_racyWindow = 1;           ///< Роздільність File::getLastModifiedTime
+#endif
+
+#pragma pack(push, 1)
+    struct EntryHeader
+    {
+        char magic[4];
+        uint32_t version;
+        uint64_t key;
+        uint64_t size;
+        uint64_t hash;          ///< XXH64 даних запису
+    };
+
+    struct IndexHeader
+    {
+        char magic[4];
+        uint32_t version;
+        uint64_t entryCount;
+        uint64_t sourceCount;
+        uint64_t clock;
+    };
+
+    struct IndexEntry
+    {
+        uint64_t key;
+        uint64_t lastAccess;
+    };
+
+    struct IndexSource
+    {
+        uint64_t modified;
+        uint64_t size;
+        uint64_t hash;
+        uint64_t hashedAt;
+        uint32_t pathLength;
+    };
+#pragma pack(pop)
+
+    struct CacheEntry
+    {
+        uint64_t size = 0;
+        uint64_t lastAccess = 0;
+    };
+
+    struct SourceHash
+    {
+        uint64_t modified = 0;
+        uint64_t size = 0;
+        uint64_t hash = 0;
+        uint64_t hashedAt = 0;  ///< Час хешування в одиницях File::getLastModifiedTime
+    };
+
+    std::mutex s_mutex;
+    std::string s_directory;
+    bool s_initialized = false;
+    uint64_t s_budget = 0;
+    uint64_t s_clock = 0;
+    uint64_t s_usage = 0;
+    std::unordered_map<uint64_t, CacheEntry> s_entries;
+    std::unordered_map<std::string, SourceHash> s_sources;
+    DerivedDataStats s_stats;
+    std::atomic<uint64_t> s_tempCounter{ 0 };
+
+    /// Поточний час у тих самих одиницях, що й File::getLastModifiedTime.
+    uint64_t current_file_time()
+    {
+#ifdef PLATFORM_WINDOWS
+        FILETIME time;
+        GetSystemTimeAsFileTime(&time);
+        return (static_cast<uint64_t>(time.dwHighDateTime) << 32) | time.dwLowDateTime;
+#else
+        return static_cast<uint64_t>(std::time(nullptr));
+#endif
+    }
+
+    std::string key_name(uint64_t key)
+    {
+        char buffer[17];
+        std::snprintf(buffer, sizeof(buffer), "%016llx", static_cast<unsigned long long>(key));
+        return buffer;
+    }
+
+    /// Записи розкладені по 256 піддиректоріях за першим байтом ключа.
+    std::string entry_path(uint64_t key)
+    {
+        std::string name = key_name(key);
+        return s_directory + "/" + name.substr(0, 2) + "/" + name + k_entryExtension;
+    }
+
+    /// Чи ім'я файлу закінчується суфіксом тимчасового файлу write_atomic (".tmp<цифри>_<цифри>").
+    bool is_temp_file(std::string_view path)
+    {
+        std::string_view name = Path::getFilename(path);
+        size_t marker = name.rfind(k_tempMarker);
+        if (marker == std::string_view::npos || marker == 0) return false;
+
+        std::string_view suffix = name.substr(marker + k_tempMarker.size());
+        size_t separator = suffix.find('_');
+        if (separator == 0 || separator == std::string_view::npos || separator + 1 == suffix.size()) return false;
+
+        auto is_digit = [](char c) { return c >= '0' && c <= '9'; };
+        return std::all_of(suffix.begin(), suffix.begin() + separator, is_digit) &&
+            std::all_of(suffix.begin() + separator + 1, suffix.end(), is_digit);
+    }
+
+    /**
+     * @brief Записує файл атомарно: спочатку у тимчасовий файл, потім rename.
+     */
+    bool write_atomic(const std::string& path, std::span<const uint8_t> head, std::span<const uint8_t> body)
+    {
+        std::string temp = path + std::string(k_tempMarker) + std::to_string(s_tempCounter++) + "_" +
+            std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+        {
+            std::ofstream file(temp, std::ios::binary | std::ios::trunc);
+            if (!file) return false;
+            file.write(reinterpret_cast<const char*>(head.data()), head.size());
+            file.write(reinterpret_cast<const char*>(body.data()), body.size());
+            if (!file.good())
+            {
+                file.close();
+                File::deleteFile(temp);
+                return false;
+            }
+        }
+
+        if (File::rename(temp, path)) return true;
+
+        // Windows не замінює існуючий файл через rename
+        File::deleteFile(path);
+        if (File::rename(temp, path)) return true;
+
+        File::deleteFile(temp);
+        return false;
+    }
+
+    void erase_entry(uint64_t key)
+    {
+        auto it = s_entries.find(key);
+        if (it == s_entries.end()) return;
+        s_usage -= it->second.size;
+        s_entries.erase(it);
+    }
+
+    void set_entry(uint64_t key, const CacheEntry& entry)
+    {
+        erase_entry(key);
+        s_entries[key] = entry;
+        s_usage += entry.size;
+    }
+
+    /// Витісняє найдавніше використані записи до target байтів; під s_mutex.
+    void evict(uint64_t target)
+    {
+        if (s_usage <= target) return;
+
+        std::vector<std::pair<uint64_t, uint64_t>> order;
+        order.reserve(s_entries.size());
+        for (const auto& [key, entry] : s_entries) order.emplace_back(entry.lastAccess, key);
+        std::sort(order.begin(), order.end());
+
+        for (const auto& [lastAccess, key] : order)
+        {
+            if (s_usage <= target) break;
+
+            File::deleteFile(entry_path(key));
+            erase_entry(key);
+            s_stats.evictions++;
+        }
+    }
+
+    void load_index(std::unordered_map<uint64_t, uint64_t>& lastAccess)
+    {
+        MappedFile file;
+        if (!file.open(s_directory + "/" + k_indexName)) return;
+
+        auto header = file.slice(0, sizeof(IndexHeader));
+        if (header.empty()) return;
+
+        IndexHeader index;
+        std::memcpy(&index, header.data(), sizeof(index));
+        if (std::memcmp(index.magic, k_indexMagic, 4) != 0 || index.version != k_formatVersion) return;
+        s_clock = index.clock;
+
+        uint64_t offset = sizeof(IndexHeader);
+        for (uint64_t i = 0; i < index.entryCount; i++, offset += sizeof(IndexEntry))
+        {
+            auto bytes = file.slice(offset, sizeof(IndexEntry));
+            if (bytes.empty()) return;
+
+            IndexEntry entry;
+            std::memcpy(&entry, bytes.data(), sizeof(entry));
+            lastAccess[entry.key] = entry.lastAccess;
+        }
+
+        for (uint64_t i = 0; i < index.sourceCount; i++)
+        {
+            auto bytes = file.slice(offset, sizeof(IndexSource));
+            if (bytes.empty()) return;
+
+            IndexSource source;
+            std::memcpy(&source, bytes.data(), sizeof(source));
+            offset += sizeof(IndexSource);
+
+            auto path = file.slice(offset, source.pathLength);
+            if (path.size() != source.pathLength) return;
+            offset += source.pathLength;
+
+            s_sources[std::string(reinterpret_cast<const char*>(path.data()), path.size())] =
+                SourceHash{ source.modified, source.size, source.hash, source.hashedAt };
+        }
+    }
+
+    void save_index()
+    {
+        std::vector<uint8_t> data;
+        auto append = [&data](const void* value, size_t size) {
+            const uint8_t* bytes = static_cast<const uint8_t*>(value);
+            data.insert(data.end(), bytes, bytes + size);
+        };
+
+        IndexHeader header{};
+        std::memcpy(header.magic, k_indexMagic, 4);
+        header.version = k_formatVersion;
+        header.entryCount = s_entries.size();
+        header.sourceCount = s_sources.size();
+        header.clock = s_clock;
+        append(&header, sizeof(header));
+
+        for (const auto& [key, entry] : s_entries)
+        {
+            IndexEntry record{ key, entry.lastAccess };
+            append(&record, sizeof(record));
+        }
+
+        for (const auto& [path, source] : s_sources)
+        {
+            IndexSource record{ source.modified, source.size, source.hash, source.hashedAt, static_cast<uint32_t>(path.size()) };
+            append(&record, sizeof(record));
+            append(path.data(), path.size());
+        }
+
+        if (!write_atomic(s_directory + "/" + k_indexName, data, {}))
+        {
+            LOG_ERROR("ERROR::DDC::INDEX_WRITE->{}", s_directory);
+        }
+    }
+}
+
+bool DerivedDataCache::init(const std::string& directory, uint64_t budgetBytes)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (s_initialized) return true;
+
+    if (!Directory::createRecursive(directory))
+    {
+        LOG_ERROR("ERROR::DDC::CREATE_DIRECTORY->{}", directory);
+        return false;
+    }
+
+    s_directory = directory;
+    s_budget = budgetBytes;
+    s_stats = {};
+
+    std::unordered_map<uint64_t, uint64_t> lastAccess;
+    load_index(lastAccess);
+
+    // Індекс може відставати від диска після аварійного завершення, тому записи
+    // завжди відновлюються з файлів, а індекс дає лише порядок використання
+    DirectoryWalkOptions options;
+    options.maxDepth = 1;
+    for (const auto& entry : Directory::walk(directory, options))
+    {
+        std::string osPath = Path::join(directory, entry.path);
+        if (is_temp_file(entry.path))
+        {
+            File::deleteFile(osPath);
+            continue;
+        }
+        if (Path::getExtention(entry.path) != k_entryExtension) continue;
+
+        std::string_view name = Path::getFilenameWithoutExtention(entry.path);
+        uint64_t key = std::strtoull(std::string(name).c_str(), nullptr, 16);
+        auto it = lastAccess.find(key);
+        set_entry(key, CacheEntry{ File::getSize(osPath), it != lastAccess.end() ? it->second : 0 });
+    }
+
+    s_initialized = true;
+    evict(s_budget);
+    LOG_INFO("DDC::INIT->{} ({} entries, {} bytes)", directory, s_entries.size(), s_usage);
+    return true;
+}
+
+void DerivedDataCache::shutdown()
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (!s_initialized) return;
+
+    save_index();
+    s_entries.clear();
+    s_usage = 0;
+    s_sources.clear();
+    s_initialized = false;
+    LOG_INFO("DDC::SHUTDOWN");
+}
+
+uint64_t DerivedDataCache::hashFile(const std::string& path)
+{
+    std::string osPath = VirtualFileSystem::resolveOSPath(path);
+    FileMetadata metadata;
+    if (!osPath.empty()) File::getMetadata(osPath, metadata);
+    uint64_t modified = metadata.modified;
+
+    if (modified != 0)
+    {
+        uint64_t size = metadata.size;
+        std::lock_guard<std::mutex> lock(s_mutex);
+        auto it = s_sources.find(osPath);
+        // Файл, змінений у ту ж секунду, коли його хешували, міг змінитись ще раз
+        if (it != s_sources.end() && it->second.modified == modified && it->second.size == size &&
+            modified + k_racyWindow < it->second.hashedAt)
+        {
+            return it->second.hash;
+        }
+    }
+
+    uint64_t hashedAt = current_file_time();
+    VirtualFile file;
+    if (!VirtualFileSystem::open(path, file)) return 0;
+    uint64_t hash = Hash::xxh64(file.bytes().data(), file.bytes().size());
+
+    if (modified != 0)
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        s_sources[osPath] = SourceHash{ modified, file.size(), hash, hashedAt };
+    }
+    return hash;
+}
+
+uint64_t DerivedDataCache::makeKey(const std::vector<std::string>& sourcePaths, std::string_view salt)
+{
+    uint64_t key = Hash::combine(k_formatVersion, Hash::fnv1a64(salt));
+    for (const auto& path : sourcePaths)
+    {
+        uint64_t hash = hashFile(path);
+        if (hash == 0) return 0;
+        key = Hash::combine(key, hash);
+    }
+    return key == 0 ? 1 : key;
+}
+
+bool DerivedDataCache::get(uint64_t key, std::vector<uint8_t>& out)
+{
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        if (!s_initialized) return false;
+        if (!s_entries.count(key))
+        {
+            s_stats.misses++;
+            return false;
+        }
+    }
+
+    MappedFile file;
+    bool valid = file.open(entry_path(key));
+    if (valid)
+    {
+        EntryHeader header{};
+        auto bytes = file.slice(0, sizeof(header));
+        if (!bytes.empty()) std::memcpy(&header, bytes.data(), sizeof(header));
+
+        auto payload = file.slice(sizeof(header), header.size);
+        valid = !bytes.empty() && std::memcmp(header.magic, k_entryMagic, 4) == 0 &&
+            header.version == k_formatVersion && header.key == key &&
+            file.size() == sizeof(header) + header.size && payload.size() == header.size &&
+            Hash::xxh64(payload.data(), payload.size()) == header.hash;
+
+        if (valid) out.assign(payload.begin(), payload.end());
+    }
+
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (!valid)
+    {
+        LOG_WARN("DDC::CORRUPTED_ENTRY->{}", key_name(key));
+        file.close();
+        File::deleteFile(entry_path(key));
+        erase_entry(key);
+        s_stats.misses++;
+        return false;
+    }
+
+    auto it = s_entries.find(key);
+    if (it != s_entries.end()) it->second.lastAccess = ++s_clock;
+    s_stats.hits++;
+    return true;
+}
+
+bool DerivedDataCache::put(uint64_t key, std::span<const uint8_t> data)
+{
+    std::string path;
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        if (!s_initialized) return false;
+        path = entry_path(key);
+    }
+
+    EntryHeader header{};
+    std::memcpy(header.magic, k_entryMagic, 4);
+    header.version = k_formatVersion;
+    header.key = key;
+    header.size = data.size();
+    header.hash = Hash::xxh64(data.data(), data.size());
+
+    if (!Directory::createRecursive(std::string(Path::getDirectory(path))) ||
+        !write_atomic(path, { reinterpret_cast<const uint8_t*>(&header), sizeof(header) }, data))
+    {
+        LOG_ERROR("ERROR::DDC::WRITE->{}", path);
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(s_mutex);
+    set_entry(key, CacheEntry{ sizeof(header) + data.size(), ++s_clock });
+    if (s_usage > s_budget) evict(s_budget / 10 * 9);
+    return true;
+}
+
+bool DerivedDataCache::getOrCompute(const std::vector<std::string>& sourcePaths, std::string_view salt,
+    const Producer& produce, std::vector<uint8_t>& out)
+{
+    uint64_t key = isInitialized() ? makeKey(sourcePaths, salt) : 0;
+    if (key != 0 && get(key, out)) return true;
+
+    out.clear();
+    if (!produce(out)) return false;
+
+    if (key != 0) put(key, out);
+    return true;
+}
+
+bool DerivedDataCache::remove(uint64_t key)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (!s_entries.count(key)) return false;
+    erase_entry(key);
+    File::deleteFile(entry_path(key));
+    return true;
+}
+
+void DerivedDataCache::setBudget(uint64_t budgetBytes)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_budget = budgetBytes;
+    if (s_initialized) evict(s_budget);
+}
+
+DerivedDataStats DerivedDataCache::getStats()
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    DerivedDataStats stats = s_stats;
+    stats.diskUsage = s_usage;
+    stats.entryCount = s_entries.size();
+    return stats;
+}
+
+bool DerivedDataCache::isInitialized()
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    return s_initialized;
+}
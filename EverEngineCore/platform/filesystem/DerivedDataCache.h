@@ -0,0 +1,116 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <span>
+#include <functional>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @brief Статистика кешу похідних даних.
+ */
+struct DerivedDataStats
+{
+    uint64_t hits = 0;          ///< Кількість знайдених записів
+    uint64_t misses = 0;        ///< Кількість промахів
+    uint64_t evictions = 0;     ///< Кількість витіснених записів
+    uint64_t diskUsage = 0;     ///< Обсяг записів на диску в байтах
+    uint64_t entryCount = 0;    ///< Кількість записів
+};
+
+/**
+ * @brief Постійний дисковий кеш похідних даних (скомпільовані шейдери, розібрані меші тощо).
+ *
+ * Ключ запису - хеш вмісту вихідних файлів (XXH64), поєднаний із "сіллю"
+ * перетворення (назва та версія алгоритму), тож будь-яка зміна джерела
+ * або алгоритму дає новий ключ, а старий запис з часом витісняється.
+ * Хеші вихідних файлів кешуються в індексі в пам'яті та перевіряються
+ * за часом модифікації та розміром, тому незмінний файл не перечитується.
+ * Записи витісняються за принципом LRU, коли загальний розмір перевищує
+ * бюджет. Файли записуються атомарно (тимчасовий файл + rename), а індекс
+ * зберігається у shutdown() і відновлюється в init().
+ *
+ * @code
+ * std::vector<uint8_t> mesh;
+ * DerivedDataCache::getOrCompute({ "assets/models/ship.obj" }, "ObjParser v3",
+ *     [](std::vector<uint8_t>& out) { return parseObj("assets/models/ship.obj", out); },
+ *     mesh);
+ * @endcode
+ */
+class DerivedDataCache
+{
+public:
+    using Producer = std::function<bool(std::vector<uint8_t>& out)>;
+
+    /**
+     * @brief Відкриває кеш у директорії (створює її за потреби) та завантажує індекс.
+     * @param directory Директорія кешу.
+     * @param budgetBytes Максимальний обсяг записів на диску.
+     * @return true, якщо кеш готовий до роботи.
+     */
+    static bool init(const std::string& directory, uint64_t budgetBytes = 512ull * 1024 * 1024);
+
+    /**
+     * @brief Зберігає індекс та закриває кеш.
+     */
+    static void shutdown();
+
+    /**
+     * @brief Повертає хеш вмісту файлу (0, якщо файл недоступний).
+     *
+     * Шлях розв'язується через VirtualFileSystem. Для файлів на диску результат
+     * кешується і перераховується лише після зміни часу модифікації або розміру.
+     */
+    static uint64_t hashFile(const std::string& path);
+
+    /**
+     * @brief Обчислює ключ запису з вмісту вихідних файлів та солі.
+     * @return Ключ або 0, якщо хоча б один файл недоступний.
+     */
+    static uint64_t makeKey(const std::vector<std::string>& sourcePaths, std::string_view salt);
+
+    /**
+     * @brief Читає запис за ключем.
+     * @return true, якщо запис знайдено та він не пошкоджений.
+     */
+    static bool get(uint64_t key, std::vector<uint8_t>& out);
+
+    /**
+     * @brief Записує запис (атомарно) та за потреби витісняє старі.
+     * @return true, якщо запис збережено.
+     */
+    static bool put(uint64_t key, std::span<const uint8_t> data);
+
+    /**
+     * @brief Повертає кешований результат або обчислює та зберігає його.
+     * @param sourcePaths Вихідні файли, від яких залежить результат.
+     * @param salt Назва та версія перетворення.
+     * @param produce Функція, що обчислює результат.
+     * @param out Результат.
+     * @return true, якщо результат отримано (з кешу або обчислено).
+     */
+    static bool getOrCompute(const std::vector<std::string>& sourcePaths, std::string_view salt,
+        const Producer& produce, std::vector<uint8_t>& out);
+
+    /**
+     * @brief Видаляє запис.
+     */
+    static bool remove(uint64_t key);
+
+    /**
+     * @brief Змінює бюджет та одразу витісняє записи понад нього.
+     */
+    static void setBudget(uint64_t budgetBytes);
+
+    /**
+     * @brief Повертає статистику кешу.
+     */
+    static DerivedDataStats getStats();
+
+    /**
+     * @brief Перевіряє, чи відкритий кеш.
+     */
+    static bool isInitialized();
+};
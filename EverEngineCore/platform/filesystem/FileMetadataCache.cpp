@@ -0,0 +1,345 @@
+#include "EverEngineCore/platform/filesystem/FileMetadataCache.h"
+#include "EverEngineCore/platform/filesystem/VirtualFileSystem.h"
+#include "EverEngineCore/platform/Platform.h"
+#include "EverEngineCore/core/Log.h"
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#ifdef PLATFORM_LINUX
+#include <sys/inotify.h>
+#include <sys/eventfd.h>
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    /// Частину ліміту inotify залишаємо для FileWatcher.
+    constexpr size_t k_maxWatchedDirectories = 4096;
+
+    struct MetadataEntry
+    {
+        FileMetadata metadata;
+        Clock::time_point checkedAt;
+        bool watched = false;   ///< Запис скидається подією inotify, повторна перевірка не потрібна
+    };
+
+    std::mutex s_mutex;
+    std::unordered_map<std::string, MetadataEntry, StringViewHash, std::equal_to<>> s_entries;
+    std::atomic<uint32_t> s_revalidateMs{ 1000 };
+    std::atomic<bool> s_running{ false };
+    uint64_t s_generation = 0;  ///< Зростає з кожним скиданням, щоб не зберегти застарілий результат statx
+    FileMetadataStats s_stats;
+
+    /// Директорія, у якій лежить шлях (у загальному вигляді).
+    std::string_view parent_directory(std::string_view path)
+    {
+        size_t pos = path.find_last_of('/');
+        if (pos == std::string_view::npos) return ".";
+        if (pos == 0) return "/";
+        return path.substr(0, pos);
+    }
+
+    /// Скидає запис шляху (під s_mutex).
+    void invalidate(std::string_view path)
+    {
+        // Лічильник зростає й без запису: statx для цього шляху може бути ще в дорозі
+        s_generation++;
+
+        auto it = s_entries.find(path);
+        if (it == s_entries.end()) return;
+
+        s_entries.erase(it);
+        s_stats.invalidations++;
+    }
+
+    /// Скидає записи директорії та всіх шляхів безпосередньо в ній (під s_mutex).
+    void invalidate_directory(std::string_view directory)
+    {
+        for (auto it = s_entries.begin(); it != s_entries.end();)
+        {
+            if (it->first == directory || parent_directory(it->first) == directory)
+            {
+                it = s_entries.erase(it);
+                s_stats.invalidations++;
+            }
+            else
+            {
+                ++it;
+            }
+        }
+        s_generation++;
+    }
+
+    void invalidate_all()
+    {
+        s_stats.invalidations += s_entries.size();
+        s_entries.clear();
+        s_generation++;
+    }
+
+#ifdef PLATFORM_LINUX
+    constexpr uint32_t k_watchMask = IN_CREATE | IN_DELETE | IN_MODIFY | IN_ATTRIB | IN_CLOSE_WRITE |
+        IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR;
+
+    int s_inotify = -1;
+    int s_wakeFd = -1;
+    std::thread s_thread;
+
+    /// Різні записи однієї директорії ("a" та "b/../a") дають той самий дескриптор.
+    std::unordered_map<int, std::vector<std::string>> s_watchDirectories;
+    std::unordered_map<std::string, int, StringViewHash, std::equal_to<>> s_directoryWatches;
+
+    /**
+     * @brief Встановлює спостереження за директорією (під s_mutex).
+     * @return true, якщо зміни в директорії будуть повідомлені.
+     */
+    bool watch_directory(std::string_view directory)
+    {
+        if (!s_running) return false;
+        if (s_directoryWatches.find(directory) != s_directoryWatches.end()) return true;
+        if (s_directoryWatches.size() >= k_maxWatchedDirectories) return false;
+
+        std::string path(directory);
+        int wd = inotify_add_watch(s_inotify, path.c_str(), k_watchMask);
+        if (wd < 0) return false;
+
+        s_watchDirectories[wd].push_back(path);
+        s_directoryWatches.emplace(std::move(path), wd);
+        return true;
+    }
+
+    /// Забуває дескриптор та скидає записи його директорій (під s_mutex).
+    void drop_watch(int wd, bool removeFromKernel)
+    {
+        auto it = s_watchDirectories.find(wd);
+        if (it == s_watchDirectories.end()) return;
+
+        if (removeFromKernel) inotify_rm_watch(s_inotify, wd);
+        for (const auto& directory : it->second)
+        {
+            invalidate_directory(directory);
+            s_directoryWatches.erase(directory);
+        }
+        s_watchDirectories.erase(it);
+    }
+
+    void handle_event(const inotify_event* event)
+    {
+        if (event->mask & IN_Q_OVERFLOW)
+        {
+            invalidate_all();
+            return;
+        }
+
+        auto it = s_watchDirectories.find(event->wd);
+        if (it == s_watchDirectories.end()) return;
+
+        if (event->mask & (IN_IGNORED | IN_DELETE_SELF | IN_MOVE_SELF))
+        {
+            // Після переміщення дескриптор дивиться на інший шлях, тож він більше не потрібен
+            drop_watch(event->wd, (event->mask & IN_MOVE_SELF) != 0);
+            return;
+        }
+        if (event->len == 0) return;
+
+        std::string path;
+        for (const auto& directory : it->second)
+        {
+            if (directory == ".") path = event->name;
+            else path.assign(directory).append(directory.back() == '/' ? "" : "/").append(event->name);
+
+            invalidate(path);
+            // Вміст директорії змінився, отже і її час модифікації
+            invalidate(directory);
+        }
+    }
+
+    void watch_thread()
+    {
+        alignas(inotify_event) char buffer[16 * 1024];
+        pollfd fds[2] = {
+            { s_inotify, POLLIN, 0 },
+            { s_wakeFd, POLLIN, 0 }
+        };
+
+        while (s_running)
+        {
+            if (poll(fds, 2, -1) < 0) continue;
+            if (fds[1].revents & POLLIN) break;
+            if (!(fds[0].revents & POLLIN)) continue;
+
+            ssize_t length = read(s_inotify, buffer, sizeof(buffer));
+            if (length <= 0) continue;
+
+            std::lock_guard<std::mutex> lock(s_mutex);
+            for (char* ptr = buffer; ptr < buffer + length;)
+            {
+                const inotify_event* event = reinterpret_cast<const inotify_event*>(ptr);
+                handle_event(event);
+                ptr += sizeof(inotify_event) + event->len;
+            }
+        }
+    }
+#else
+    bool watch_directory(std::string_view directory)
+    {
+        (void)directory;
+        return false;
+    }
+#endif
+}
+
+#ifdef PLATFORM_LINUX
+
+bool FileMetadataCache::init(uint32_t revalidateMs)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_revalidateMs = revalidateMs;
+    if (s_running) return true;
+
+    s_inotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    s_wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (s_inotify < 0 || s_wakeFd < 0)
+    {
+        LOG_ERROR("ERROR::FILE_METADATA_CACHE::INIT");
+        if (s_inotify >= 0) close(s_inotify);
+        if (s_wakeFd >= 0) close(s_wakeFd);
+        s_inotify = s_wakeFd = -1;
+        return false;
+    }
+
+    // Записи, зроблені до запуску спостереження, ним не покриті
+    invalidate_all();
+    s_running = true;
+    s_thread = std::thread(watch_thread);
+    LOG_INFO("FILE_METADATA_CACHE::INIT");
+    return true;
+}
+
+void FileMetadataCache::shutdown()
+{
+    if (s_running)
+    {
+        s_running = false;
+        uint64_t value = 1;
+        (void)write(s_wakeFd, &value, sizeof(value));
+        if (s_thread.joinable()) s_thread.join();
+    }
+
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (s_inotify >= 0)
+    {
+        close(s_inotify);
+        close(s_wakeFd);
+        s_inotify = s_wakeFd = -1;
+        LOG_INFO("FILE_METADATA_CACHE::SHUTDOWN");
+    }
+    s_watchDirectories.clear();
+    s_directoryWatches.clear();
+    s_entries.clear();
+}
+
+#else
+
+bool FileMetadataCache::init(uint32_t revalidateMs)
+{
+    s_revalidateMs = revalidateMs;
+    LOG_WARN("FILE_METADATA_CACHE::WATCH_UNSUPPORTED");
+    return false;
+}
+
+void FileMetadataCache::shutdown()
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_entries.clear();
+}
+
+#endif
+
+FileMetadata FileMetadataCache::get(std::string_view path)
+{
+    thread_local std::string key;
+    Path::normalizeGeneric(path, key);
+
+    Clock::time_point now = Clock::now();
+    uint64_t generation = 0;
+    bool watched = false;
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        auto it = s_entries.find(key);
+        if (it != s_entries.end() &&
+            (it->second.watched || now - it->second.checkedAt < std::chrono::milliseconds(s_revalidateMs.load())))
+        {
+            s_stats.hits++;
+            return it->second.metadata;
+        }
+        s_stats.misses++;
+
+        // Спостереження встановлюється до statx, інакше зміна між ними загубиться
+        watched = watch_directory(parent_directory(key));
+        generation = s_generation;
+    }
+
+    FileMetadata metadata;
+    File::getMetadata(key, metadata);
+
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (generation == s_generation)
+    {
+        // Зміни вмісту директорії видно лише спостереженню за нею самою
+        watched = watched && !metadata.isDirectory();
+        s_entries.insert_or_assign(key, MetadataEntry{ metadata, now, watched });
+    }
+    return metadata;
+}
+
+void FileMetadataCache::refresh(std::string_view path)
+{
+    std::string key;
+    Path::normalizeGeneric(path, key);
+
+    std::lock_guard<std::mutex> lock(s_mutex);
+    invalidate(key);
+}
+
+void FileMetadataCache::refreshAll()
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    invalidate_all();
+}
+
+void FileMetadataCache::setRevalidateInterval(uint32_t milliseconds)
+{
+    s_revalidateMs = milliseconds;
+}
+
+FileMetadataStats FileMetadataCache::getStats()
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    FileMetadataStats stats = s_stats;
+    stats.entryCount = s_entries.size();
+#ifdef PLATFORM_LINUX
+    stats.watchedDirectories = s_directoryWatches.size();
+#endif
+    return stats;
+}
+
+void FileMetadataCache::resetStats()
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_stats = {};
+}
+
+bool FileMetadataCache::isInitialized()
+{
+    return s_running;
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <string_view>
+#include <cstdint>
+#include <cstddef>
+
+#include "EverEngineCore/platform/filesystem/FileSystem.h"
+
+/**
+ * @brief Статистика кешу метаданих файлів.
+ */
+struct FileMetadataStats
+{
+    uint64_t hits = 0;              ///< Відповіді з пам'яті
+    uint64_t misses = 0;            ///< Запити, що потребували statx
+    uint64_t invalidations = 0;     ///< Записи, скинуті через зміни на диску або refresh()
+    uint64_t entryCount = 0;        ///< Кількість записів
+    uint64_t watchedDirectories = 0;///< Кількість директорій під inotify-спостереженням
+};
+
+/**
+ * @brief Кеш метаданих файлів (наявність, тип, розмір, час модифікації).
+ *
+ * Повторні перевірки того самого шляху відповідаються з пам'яті; промах
+ * коштує одного File::getMetadata (statx). Відсутні шляхи теж кешуються.
+ *
+ * На Linux після init() кеш тримає власне inotify-спостереження за
+ * батьківськими директоріями кешованих шляхів: фоновий потік скидає
+ * запис одразу після події (без debounce, на відміну від FileWatcher),
+ * тож такі записи не перевіряються повторно. Записи, для яких
+ * спостереження встановити не вдалося (директорії ще немає, вичерпано
+ * ліміт inotify, інші платформи), перевіряються заново через інтервал
+ * revalidateMs. Зміни цілі символьного посилання з іншої директорії
+ * спостереженням не помічаються.
+ *
+ * @code
+ * if (FileMetadataCache::isFile("assets/shaders/basic.vert"))
+ *     size = FileMetadataCache::getSize("assets/shaders/basic.vert");
+ * @endcode
+ */
+class FileMetadataCache
+{
+public:
+    /**
+     * @brief Запускає inotify-спостереження за кешованими директоріями.
+     * @param revalidateMs Інтервал повторної перевірки записів без спостереження.
+     * @return true, якщо спостереження працює (false на платформах без підтримки).
+     */
+    static bool init(uint32_t revalidateMs = 1000);
+
+    /**
+     * @brief Зупиняє спостереження та очищає кеш.
+     */
+    static void shutdown();
+
+    /**
+     * @brief Повертає метадані шляху.
+     * @param path Шлях до файлу або директорії.
+     * @return Метадані (FileType::None, якщо об'єкт не існує).
+     */
+    static FileMetadata get(std::string_view path);
+
+    static bool exists(std::string_view path) { return get(path).exists(); }
+    static bool isFile(std::string_view path) { return get(path).isFile(); }
+    static bool isDirectory(std::string_view path) { return get(path).isDirectory(); }
+    static uint64_t getSize(std::string_view path) { return get(path).size; }
+    static uint64_t getLastModifiedTime(std::string_view path) { return get(path).modified; }
+
+    /**
+     * @brief Скидає запис шляху (наступний запит звернеться до диска).
+     */
+    static void refresh(std::string_view path);
+
+    /**
+     * @brief Скидає всі записи.
+     */
+    static void refreshAll();
+
+    /**
+     * @brief Змінює інтервал повторної перевірки записів без спостереження.
+     */
+    static void setRevalidateInterval(uint32_t milliseconds);
+
+    /**
+     * @brief Повертає статистику кешу.
+     */
+    static FileMetadataStats getStats();
+
+    /**
+     * @brief Обнуляє лічильники влучань, промахів та скидань.
+     */
+    static void resetStats();
+
+    /**
+     * @brief Перевіряє, чи працює inotify-спостереження.
+     */
+    static bool isInitialized();
+};
@@ -1,9 +1,15 @@
 #include <fstream>
-#include <sstream>
 #include <cstring>
 #include <algorithm>
+#include <memory>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <set>
 #include <thread>
 #include "EverEngineCore/platform/filesystem/FileSystem.h"
+#include "EverEngineCore/platform/filesystem/LineReader.h"
+#include "EverEngineCore/platform/Platform.h"
 
 #ifdef PLATFORM_WINDOWS
 #include <windows.h>
@@ -12,9 +18,18 @@
 #define mkdir(path) _mkdir(path)
 #else
 #include <unistd.h>
+#include <fcntl.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
 #include <dirent.h>
 #include <libgen.h>
+#include <cerrno>
+#endif
+
+#ifdef PLATFORM_LINUX
+#include <sys/ioctl.h>
+#include <sys/sendfile.h>
+#include <linux/fs.h>
 #endif
 
 #ifdef PLATFORM_WINDOWS
@@ -23,62 +38,103 @@
     const char Path::separator = '/';
 #endif
 
-std::string Path::normalize(const std::string& path) 
+std::string Path::normalize(std::string_view path) 
+{
+    std::string result;
+    normalize(path, result);
+    return result;
+}
+
+void Path::normalize(std::string_view path, std::string& out)
 {
-    std::string result =path;
-    std::replace(result.begin(), result.end(),
+    out.assign(path);
+    std::replace(out.begin(), out.end(),
         separator == '/' ? '\\' : '/',
         separator);
+}
+
+void Path::normalizeGeneric(std::string_view path, std::string& out)
+{
+    out.clear();
+    out.reserve(path.size());
+
+    for (size_t i = 0; i < path.size(); i++)
+    {
+        char c = path[i] == '\\' ? '/' : path[i];
+        if (c == '/' && !out.empty() && out.back() == '/') continue;
+        out += c;
+
+        // "./" на початку або після роздільника нічого не змінює
+        if (c == '/' && out.size() >= 2 && out[out.size() - 2] == '.' &&
+            (out.size() == 2 || out[out.size() - 3] == '/'))
+        {
+            out.resize(out.size() - 2);
+        }
+    }
+
+    if (out.size() > 1 && out.back() == '/') out.pop_back();
+}
 
+std::string Path::join(std::string_view a, std::string_view b) 
+{
+    std::string result;
+    join(a, b, result);
     return result;
 }
 
-std::string Path::join(const std::string& a, const std::string& b) 
+void Path::join(std::string_view a, std::string_view b, std::string& out)
 {
-    if (a.empty()) return b;
-    if (b.empty()) return a;
+    if (a.empty() || b.empty())
+    {
+        out.assign(a.empty() ? b : a);
+        return;
+    }
 
-    std::string result = a;
-    if (result.back() != separator && result.back() != '/' && result.back() != '\\')
+    out.clear();
+    out.reserve(a.size() + b.size() + 1);
+    out.append(a);
+    if (out.back() != separator && out.back() != '/' && out.back() != '\\')
     {
-        result += separator;
+        out += separator;
     }
-    result += b;
+    out.append(b);
 
-    return normalize(result);
+    std::replace(out.begin(), out.end(),
+        separator == '/' ? '\\' : '/',
+        separator);
 }
 
-std::string Path::getDirectory(const std::string& path)
+std::string_view Path::getDirectory(std::string_view path)
 {
     size_t pos = path.find_last_of("/\\");
-    if (pos == std::string::npos) return "";
+    if (pos == std::string_view::npos) return {};
     return path.substr(0, pos);
 }
 
-std::string Path::getFilename(const std::string& path) 
+std::string_view Path::getFilename(std::string_view path) 
 {
     size_t pos = path.find_last_of("/\\");
-    if (pos == std::string::npos) return path;
+    if (pos == std::string_view::npos) return path;
     return path.substr(pos + 1);
 }
 
-std::string Path::getExtention(const std::string& path) 
+std::string_view Path::getExtention(std::string_view path) 
 {
-    std::string filename = getFilename(path);
+    std::string_view filename = getFilename(path);
     size_t pos = filename.find_last_of('.');
-    if (pos == std::string::npos) return "";
+    if (pos == std::string_view::npos) return {};
     return filename.substr(pos);
 }
 
-std::string Path::getFilenameWithoutExtention(const std::string& path) 
+std::string_view Path::getFilenameWithoutExtention(std::string_view path) 
 {
-    std::string filename = getFilename(path);
+    std::string_view filename = getFilename(path);
     size_t pos = filename.find_last_of('.');
-    if (pos == std::string::npos) return filename;
+    if (pos == std::string_view::npos) return filename;
     return filename.substr(0, pos);
 }
 
-bool Path::isAbsolute(const std::string& path) 
+bool Path::isAbsolute(std::string_view path) 
 {
 #ifdef PLATFORM_WINDOWS
     return path.length() >= 2 && path[1] == ':';
@@ -90,59 +146,84 @@ bool Path::isAbsolute(const std::string& path)
 
 // File
 
-bool File::exists(const std::string& path) 
+#ifndef PLATFORM_WINDOWS
+static FileType file_type_from_mode(mode_t mode)
 {
-    std::ifstream file(path);
-    return file.good();
+    if (S_ISREG(mode)) return FileType::File;
+    if (S_ISDIR(mode)) return FileType::Directory;
+    return FileType::Other;
 }
+#endif
 
-bool File::isFile(const std::string& path) 
+bool File::getMetadata(const std::string& path, FileMetadata& out)
 {
+    out = {};
 #ifdef PLATFORM_WINDOWS
-    DWORD attr = GetFileAttributesA(path.c_str());
-    return (attr != INVALID_FILE_ATTRIBUTES && !(attr & FILE_ATTRIBUTE_DIRECTORY));
+    WIN32_FILE_ATTRIBUTE_DATA data;
+    if (!GetFileAttributesExA(path.c_str(), GetFileExInfoStandard, &data)) return false;
+
+    out.type = (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) ? FileType::Directory : FileType::File;
+    out.size = (static_cast<uint64_t>(data.nFileSizeHigh) << 32) | data.nFileSizeLow;
+    out.modified = (static_cast<uint64_t>(data.ftLastWriteTime.dwHighDateTime) << 32) | data.ftLastWriteTime.dwLowDateTime;
+    return true;
 #else
+#ifdef STATX_BASIC_STATS
+    // statx запитує лише потрібні поля; старі ядра його не мають (ENOSYS)
+    static std::atomic<bool> s_hasStatx{ true };
+    if (s_hasStatx.load(std::memory_order_relaxed))
+    {
+        struct statx st;
+        if (statx(AT_FDCWD, path.c_str(), 0, STATX_TYPE | STATX_SIZE | STATX_MTIME, &st) == 0)
+        {
+            out.type = file_type_from_mode(st.stx_mode);
+            out.size = st.stx_size;
+            out.modified = static_cast<uint64_t>(st.stx_mtime.tv_sec);
+            return true;
+        }
+        if (errno != ENOSYS) return false;
+        s_hasStatx.store(false, std::memory_order_relaxed);
+    }
+#endif
     struct stat st;
     if (stat(path.c_str(), &st) != 0) return false;
-    return S_ISREG(st.st_mode);
+
+    out.type = file_type_from_mode(st.st_mode);
+    out.size = static_cast<uint64_t>(st.st_size);
+    out.modified = static_cast<uint64_t>(st.st_mtime);
+    return true;
 #endif
 }
 
+bool File::exists(const std::string& path) 
+{
+    FileMetadata metadata;
+    return getMetadata(path, metadata);
+}
+
+bool File::isFile(const std::string& path) 
+{
+    FileMetadata metadata;
+    return getMetadata(path, metadata) && metadata.isFile();
+}
+
 bool File::isDirectory(const std::string& path) 
 {
-#ifdef PLATFORM_WINDOWS
-    DWORD attr = GetFileAttributesA(path.c_str());
-    return (attr != INVALID_FILE_ATTRIBUTES && (attr & FILE_ATTRIBUTE_DIRECTORY));
-#else
-    struct stat st;
-    if (stat(path.c_str(), &st) != 0) return false;
-    return S_ISDIR(st.st_mode);
-#endif
+    FileMetadata metadata;
+    return getMetadata(path, metadata) && metadata.isDirectory();
 }
 
 uint64_t File::getSize(const std::string& path) 
 {
-    std::ifstream file(path, std::ios::binary | std::ios::ate);
-    if (!file) return 0;
-    return static_cast<uint64_t>(file.tellg());
+    FileMetadata metadata;
+    getMetadata(path, metadata);
+    return metadata.size;
 }
 
 uint64_t File::getLastModifiedTime(const std::string& path) 
 {
-#ifdef PLATFORM_WINDOWS
-    WIN32_FILE_ATTRIBUTE_DATA data;
-    if (!GetFileAttributesExA(path.c_str(), GetFileExInfoStandard, &data)) {
-        return 0;
-    }
-    ULARGE_INTEGER ull;
-    ull.LowPart = data.ftLastWriteTime.dwLowDateTime;
-    ull.HighPart = data.ftLastWriteTime.dwHighDateTime;
-    return ull.QuadPart;
-#else
-    struct stat st;
-    if (stat(path.c_str(), &st) != 0) return 0;
-    return static_cast<uint64_t>(st.st_mtime);
-#endif
+    FileMetadata metadata;
+    getMetadata(path, metadata);
+    return metadata.modified;
 }
 
 std::vector<uint8_t> File::readBinary(const std::string& path) 
@@ -163,29 +244,35 @@ std::vector<uint8_t> File::readBinary(const std::string& path)
 
 std::string File::readText(const std::string& path) 
 {
-    std::ifstream file(path);
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
     if (!file) {
         return "";
     }
-    
-    std::stringstream buffer;
-    buffer << file.rdbuf();
-    return buffer.str();
+
+    std::string text(static_cast<size_t>(file.tellg()), '\0');
+    file.seekg(0, std::ios::beg);
+    file.read(text.data(), text.size());
+    text.resize(static_cast<size_t>(file.gcount()));
+    return text;
 }
 
 std::vector<std::string> File::readLines(const std::string& path) 
 {
-    std::ifstream file(path);
-    if (!file) {
+    LineReader reader;
+    if (!reader.open(path)) {
         return {};
     }
-    
+
     std::vector<std::string> lines;
-    std::string line;
-    while (std::getline(file, line)) {
-        lines.push_back(line);
+    if (!reader.text().empty()) {
+        lines.reserve(LineReader::countLines(reader.text()));
     }
-    
+
+    std::string_view line;
+    while (reader.next(line)) {
+        lines.emplace_back(line);
+    }
+
     return lines;
 }
 
@@ -221,17 +308,140 @@ bool File::deleteFile(const std::string& path)
     return std::remove(path.c_str()) == 0;
 }
 
-bool File::copy(const std::string& src, const std::string& dst) 
+#ifndef PLATFORM_WINDOWS
+
+/**
+ * @brief Пише весь буфер у дескриптор, повторюючи часткові записи.
+ */
+static bool write_all(int fd, const uint8_t* data, size_t size)
 {
-    std::ifstream srcFile(src, std::ios::binary);
-    std::ofstream dstFile(dst, std::ios::binary);
-    
-    if (!srcFile || !dstFile) return false;
-    
-    dstFile << srcFile.rdbuf();
+    while (size > 0)
+    {
+        ssize_t written = ::write(fd, data, size);
+        if (written < 0)
+        {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        data += written;
+        size -= static_cast<size_t>(written);
+    }
     return true;
 }
 
+/**
+ * @brief Копіює size байтів між дескрипторами, обираючи найдешевший доступний спосіб.
+ *
+ * Порядок: reflink (FICLONE, спільні блоки без копіювання даних),
+ * copy_file_range (копіювання в ядрі, серверне копіювання для NFS/SMB),
+ * sendfile, і лише потім read/write через буфер.
+ */
+static bool copy_descriptor(int in, int out, uint64_t size)
+{
+    uint64_t copied = 0;
+
+#ifdef PLATFORM_LINUX
+#ifdef FICLONE
+    if (ioctl(out, FICLONE, in) == 0) return true;
+#endif
+
+    bool kernelCopy = true;
+    while (copied < size && kernelCopy)
+    {
+        ssize_t result = copy_file_range(in, nullptr, out, nullptr, static_cast<size_t>(size - copied), 0);
+        if (result > 0)
+        {
+            copied += static_cast<uint64_t>(result);
+            continue;
+        }
+        if (result < 0 && errno == EINTR) continue;
+        if (result == 0) break;
+
+        // EXDEV, ENOSYS, EINVAL, EOPNOTSUPP: спосіб недоступний для цієї пари файлових систем
+        kernelCopy = false;
+    }
+
+    while (copied < size)
+    {
+        ssize_t result = sendfile(out, in, nullptr, static_cast<size_t>(std::min<uint64_t>(size - copied, 1ull << 30)));
+        if (result > 0)
+        {
+            copied += static_cast<uint64_t>(result);
+            continue;
+        }
+        if (result < 0 && errno == EINTR) continue;
+        break;
+    }
+#endif
+
+    if (copied < size)
+    {
+        if (lseek(in, static_cast<off_t>(copied), SEEK_SET) < 0) return false;
+        if (lseek(out, static_cast<off_t>(copied), SEEK_SET) < 0) return false;
+#ifdef PLATFORM_LINUX
+        posix_fadvise(in, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
+        std::vector<uint8_t> buffer(1024 * 1024);
+        while (copied < size)
+        {
+            ssize_t result = ::read(in, buffer.data(), buffer.size());
+            if (result < 0 && errno == EINTR) continue;
+            if (result <= 0) break;
+            if (!write_all(out, buffer.data(), static_cast<size_t>(result))) return false;
+            copied += static_cast<uint64_t>(result);
+        }
+    }
+
+    return copied == size;
+}
+
+#endif
+
+bool File::copy(const std::string& src, const std::string& dst) 
+{
+#ifdef PLATFORM_WINDOWS
+    // CopyFileEx виконує копіювання в системі без проходу даних через процес
+    return CopyFileA(src.c_str(), dst.c_str(), FALSE) != 0;
+#else
+    int in = ::open(src.c_str(), O_RDONLY | O_CLOEXEC);
+    if (in < 0) return false;
+
+    struct stat st;
+    if (fstat(in, &st) != 0 || !S_ISREG(st.st_mode))
+    {
+        ::close(in);
+        return false;
+    }
+
+    // Без O_TRUNC: dst може бути тим самим файлом (жорстке посилання, інше написання шляху),
+    // і обрізання спершу знищило б джерело
+    int out = ::open(dst.c_str(), O_WRONLY | O_CREAT | O_CLOEXEC, st.st_mode & 0777);
+    if (out < 0)
+    {
+        ::close(in);
+        return false;
+    }
+
+    struct stat dstStat;
+    if (fstat(out, &dstStat) != 0 || (dstStat.st_dev == st.st_dev && dstStat.st_ino == st.st_ino) ||
+        ftruncate(out, 0) != 0)
+    {
+        ::close(out);
+        ::close(in);
+        return false;
+    }
+
+    bool success = copy_descriptor(in, out, static_cast<uint64_t>(st.st_size));
+    success &= ::close(out) == 0;
+    ::close(in);
+
+    // Часткова копія гірша за відсутню
+    if (!success) std::remove(dst.c_str());
+    return success;
+#endif
+}
+
 bool File::move(const std::string& src, const std::string& dst) 
 {
     return std::rename(src.c_str(), dst.c_str()) == 0;
@@ -258,7 +468,7 @@ bool Directory::createRecursive(const std::string& path)
 {
     if (exists(path)) return true;
     
-    std::string parent = Path::getDirectory(path);
+    std::string parent(Path::getDirectory(path));
     if (!parent.empty() && !exists(parent)) {
         if (!createRecursive(parent)) return false;
     }
@@ -266,20 +476,209 @@ bool Directory::createRecursive(const std::string& path)
     return create(path);
 }
 
+/// Тип елемента директорії.
+enum class EntryKind
+{
+    File,
+    Directory,
+    Other
+};
+
+/**
+ * @brief Запускає fn(index) для index у [0, count) на кількох потоках.
+ */
+static void parallel_for(size_t count, uint32_t threadCount, const std::function<void(size_t)>& fn)
+{
+    size_t workers = std::min<size_t>(count, threadCount);
+    if (workers <= 1)
+    {
+        for (size_t i = 0; i < count; i++) fn(i);
+        return;
+    }
+
+    std::atomic<size_t> next{ 0 };
+    auto work = [&]() {
+        for (size_t i = next++; i < count; i = next++) fn(i);
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(workers - 1);
+    for (size_t i = 1; i < workers; i++) threads.emplace_back(work);
+    work();
+    for (auto& thread : threads) thread.join();
+}
+
+static uint32_t resolve_thread_count(uint32_t requested)
+{
+    return requested != 0 ? requested : std::max(1u, std::thread::hardware_concurrency());
+}
+
+#ifdef PLATFORM_WINDOWS
+
+/**
+ * @brief Читає вміст директорії за один прохід.
+ *
+ * callback(name, kind, isLink) викликається для кожного елемента, крім "." та "..".
+ * Точки повторного розбору (символьні посилання, junction) позначаються isLink.
+ */
+template<typename Callback>
+static bool scan_directory(const std::string& path, Callback&& callback)
+{
+    WIN32_FIND_DATAA findData;
+    HANDLE hFind = FindFirstFileExA((path + "\\*").c_str(), FindExInfoBasic, &findData,
+        FindExSearchNameMatch, nullptr, FIND_FIRST_EX_LARGE_FETCH);
+    if (hFind == INVALID_HANDLE_VALUE) return false;
+
+    do {
+        const char* name = findData.cFileName;
+        if (strcmp(name, ".") == 0 || strcmp(name, "..") == 0) continue;
+
+        EntryKind kind = (findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) ? EntryKind::Directory : EntryKind::File;
+        bool isLink = (findData.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT) != 0;
+        callback(name, kind, isLink);
+    } while (FindNextFileA(hFind, &findData));
+
+    FindClose(hFind);
+    return true;
+}
+
+static bool remove_tree(const std::string& path)
+{
+    bool success = true;
+    scan_directory(path, [&](const char* name, EntryKind kind, bool isLink) {
+        std::string child = path + "\\" + name;
+        if (kind == EntryKind::Directory)
+        {
+            success &= isLink ? _rmdir(child.c_str()) == 0 : remove_tree(child);
+        }
+        else
+        {
+            success &= DeleteFileA(child.c_str()) != 0;
+        }
+    });
+    return _rmdir(path.c_str()) == 0 && success;
+}
+
+#else
+
+/**
+ * @brief Визначає тип елемента за d_type; fstatat лише для DT_UNKNOWN та посилань.
+ * @param isLink Встановлюється у true для символьних посилань (тип - тип цілі).
+ */
+static EntryKind entry_kind(int dirFd, const dirent* entry, bool& isLink)
+{
+    isLink = false;
+    switch (entry->d_type)
+    {
+    case DT_REG: return EntryKind::File;
+    case DT_DIR: return EntryKind::Directory;
+    case DT_LNK: isLink = true; break;
+    case DT_UNKNOWN: break;
+    default: return EntryKind::Other;
+    }
+
+    struct stat st;
+    if (!isLink)
+    {
+        if (fstatat(dirFd, entry->d_name, &st, AT_SYMLINK_NOFOLLOW) != 0) return EntryKind::Other;
+        isLink = S_ISLNK(st.st_mode);
+    }
+    if (isLink && fstatat(dirFd, entry->d_name, &st, 0) != 0) return EntryKind::Other;
+
+    if (S_ISREG(st.st_mode)) return EntryKind::File;
+    if (S_ISDIR(st.st_mode)) return EntryKind::Directory;
+    return EntryKind::Other;
+}
+
+/**
+ * @brief Читає вміст директорії (відносно baseFd) за один прохід readdir.
+ *
+ * callback(dirFd, name, kind, isLink) викликається для кожного елемента, крім "." та "..".
+ * dirFd - дескриптор самої директорії для *at-викликів над елементом.
+ */
+template<typename Callback>
+static bool scan_directory(int baseFd, const char* path, Callback&& callback)
+{
+    int fd = openat(baseFd, path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fd < 0) return false;
+
+    DIR* dir = fdopendir(fd);
+    if (!dir)
+    {
+        ::close(fd);
+        return false;
+    }
+
+    struct dirent* entry;
+    while ((entry = readdir(dir)) != nullptr)
+    {
+        const char* name = entry->d_name;
+        if (name[0] == '.' && (name[1] == '\0' || (name[1] == '.' && name[2] == '\0'))) continue;
+
+        bool isLink = false;
+        EntryKind kind = entry_kind(fd, entry, isLink);
+        callback(fd, name, kind, isLink);
+    }
+
+    closedir(dir);
+    return true;
+}
+
+static bool remove_tree(int parentFd, const char* name)
+{
+    bool success = true;
+    bool scanned = scan_directory(parentFd, name, [&](int dirFd, const char* child, EntryKind kind, bool isLink) {
+        if (kind == EntryKind::Directory && !isLink)
+        {
+            success &= remove_tree(dirFd, child);
+        }
+        else
+        {
+            success &= unlinkat(dirFd, child, 0) == 0;
+        }
+    });
+    return scanned && unlinkat(parentFd, name, AT_REMOVEDIR) == 0 && success;
+}
+
+#endif
+
 bool Directory::deleteDir(const std::string& path, bool recursive) 
 {
     if (!exists(path)) return false;
     
     if (recursive) {
-        auto files = listFiles(path);
-        for (const auto& file : files) {
-            File::deleteFile(Path::join(path, file));
-        }
-        
-        auto dirs = listDirectories(path);
-        for (const auto& dir : dirs) {
-            deleteDir(Path::join(path, dir), true);
-        }
+        // Файли кореня видаляються одразу, а піддерева - паралельно
+        std::vector<std::string> subdirs;
+        bool success = true;
+
+#ifdef PLATFORM_WINDOWS
+        scan_directory(path, [&](const char* name, EntryKind kind, bool isLink) {
+            std::string child = Path::join(path, name);
+            if (kind != EntryKind::Directory) success &= DeleteFileA(child.c_str()) != 0;
+            else if (isLink) success &= _rmdir(child.c_str()) == 0;
+            else subdirs.push_back(std::move(child));
+        });
+
+        std::atomic<bool> subdirsRemoved{ true };
+        parallel_for(subdirs.size(), resolve_thread_count(0), [&](size_t i) {
+            if (!remove_tree(subdirs[i])) subdirsRemoved = false;
+        });
+#else
+        int rootFd = open(path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (rootFd < 0) return false;
+
+        scan_directory(rootFd, ".", [&](int dirFd, const char* name, EntryKind kind, bool isLink) {
+            if (kind == EntryKind::Directory && !isLink) subdirs.push_back(name);
+            else success &= unlinkat(dirFd, name, 0) == 0;
+        });
+
+        std::atomic<bool> subdirsRemoved{ true };
+        parallel_for(subdirs.size(), resolve_thread_count(0), [&](size_t i) {
+            if (!remove_tree(rootFd, subdirs[i].c_str())) subdirsRemoved = false;
+        });
+        ::close(rootFd);
+#endif
+        if (!success || !subdirsRemoved) return false;
     }
     
 #ifdef PLATFORM_WINDOWS
@@ -299,29 +698,13 @@ std::vector<std::string> Directory::listFiles(const std::string& path)
     std::vector<std::string> files;
     
 #ifdef PLATFORM_WINDOWS
-    WIN32_FIND_DATAA findData;
-    HANDLE hFind = FindFirstFileA((path + "\\*").c_str(), &findData);
-    
-    if (hFind != INVALID_HANDLE_VALUE) {
-        do {
-            if (!(findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)) {
-                files.push_back(findData.cFileName);
-            }
-        } while (FindNextFileA(hFind, &findData));
-        FindClose(hFind);
-    }
+    scan_directory(path, [&](const char* name, EntryKind kind, bool) {
+        if (kind == EntryKind::File) files.push_back(name);
+    });
 #else
-    DIR* dir = opendir(path.c_str());
-    if (dir) {
-        struct dirent* entry;
-        while ((entry = readdir(dir)) != nullptr) {
-            std::string fullPath = Path::join(path, entry->d_name);
-            if (File::isFile(fullPath)) {
-                files.push_back(entry->d_name);
-            }
-        }
-        closedir(dir);
-    }
+    scan_directory(AT_FDCWD, path.c_str(), [&](int, const char* name, EntryKind kind, bool) {
+        if (kind == EntryKind::File) files.push_back(name);
+    });
 #endif
     
     return files;
@@ -332,34 +715,13 @@ std::vector<std::string> Directory::listDirectories(const std::string& path)
     std::vector<std::string> dirs;
     
 #ifdef PLATFORM_WINDOWS
-    WIN32_FIND_DATAA findData;
-    HANDLE hFind = FindFirstFileA((path + "\\*").c_str(), &findData);
-    
-    if (hFind != INVALID_HANDLE_VALUE) {
-        do {
-            if ((findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) &&
-                strcmp(findData.cFileName, ".") != 0 &&
-                strcmp(findData.cFileName, "..") != 0) {
-                dirs.push_back(findData.cFileName);
-            }
-        } while (FindNextFileA(hFind, &findData));
-        FindClose(hFind);
-    }
+    scan_directory(path, [&](const char* name, EntryKind kind, bool) {
+        if (kind == EntryKind::Directory) dirs.push_back(name);
+    });
 #else
-    DIR* dir = opendir(path.c_str());
-    if (dir) {
-        struct dirent* entry;
-        while ((entry = readdir(dir)) != nullptr) {
-            if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) {
-                continue;
-            }
-            std::string fullPath = Path::join(path, entry->d_name);
-            if (File::isDirectory(fullPath)) {
-                dirs.push_back(entry->d_name);
-            }
-        }
-        closedir(dir);
-    }
+    scan_directory(AT_FDCWD, path.c_str(), [&](int, const char* name, EntryKind kind, bool) {
+        if (kind == EntryKind::Directory) dirs.push_back(name);
+    });
 #endif
     
     return dirs;
@@ -367,12 +729,163 @@ std::vector<std::string> Directory::listDirectories(const std::string& path)
 
 std::vector<std::string> Directory::listAll(const std::string& path) 
 {
-    auto files = listFiles(path);
-    auto dirs = listDirectories(path);
-    files.insert(files.end(), dirs.begin(), dirs.end());
+    std::vector<std::string> files;
+    std::vector<std::string> dirs;
+
+    auto collect = [&](const char* name, EntryKind kind) {
+        if (kind == EntryKind::File) files.push_back(name);
+        else if (kind == EntryKind::Directory) dirs.push_back(name);
+    };
+
+#ifdef PLATFORM_WINDOWS
+    scan_directory(path, [&](const char* name, EntryKind kind, bool) { collect(name, kind); });
+#else
+    scan_directory(AT_FDCWD, path.c_str(), [&](int, const char* name, EntryKind kind, bool) { collect(name, kind); });
+#endif
+
+    files.insert(files.end(), std::make_move_iterator(dirs.begin()), std::make_move_iterator(dirs.end()));
     return files;
 }
 
+/**
+ * @brief Ідентичність директорії (пристрій, inode / том, індекс файлу) з переходом за посиланнями.
+ */
+#ifdef PLATFORM_WINDOWS
+static bool directory_identity(const std::string& path, std::pair<uint64_t, uint64_t>& identity)
+{
+    HANDLE handle = CreateFileA(path.c_str(), 0, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+        nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS, nullptr);
+    if (handle == INVALID_HANDLE_VALUE) return false;
+
+    BY_HANDLE_FILE_INFORMATION info;
+    bool success = GetFileInformationByHandle(handle, &info) != 0;
+    CloseHandle(handle);
+    if (!success) return false;
+
+    identity = { info.dwVolumeSerialNumber,
+        (static_cast<uint64_t>(info.nFileIndexHigh) << 32) | info.nFileIndexLow };
+    return true;
+}
+#else
+static bool directory_identity(int dirFd, const char* path, std::pair<uint64_t, uint64_t>& identity)
+{
+    struct stat info;
+    if (fstatat(dirFd, path, &info, 0) != 0) return false;
+    identity = { static_cast<uint64_t>(info.st_dev), static_cast<uint64_t>(info.st_ino) };
+    return true;
+}
+#endif
+
+std::vector<DirectoryEntry> Directory::walk(const std::string& path, const DirectoryWalkOptions& options)
+{
+    std::vector<DirectoryEntry> result;
+
+#ifndef PLATFORM_WINDOWS
+    int rootFd = open(path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (rootFd < 0) return result;
+#else
+    if (!exists(path)) return result;
+#endif
+
+    struct PendingDirectory
+    {
+        std::string path;
+        uint32_t depth = 0;
+    };
+
+    // Спільний стек директорій: потік, що знайшов піддиректорії, віддає їх іншим
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::vector<PendingDirectory> pending{ PendingDirectory{} };
+    size_t busy = 0;
+
+    // З переходом за посиланнями одна директорія досяжна кількома шляхами, а посилання
+    // на предка утворює цикл: кожну директорію обходимо лише раз
+    std::mutex visitedMutex;
+    std::set<std::pair<uint64_t, uint64_t>> visited;
+    auto first_visit = [&](const std::string& relative) {
+        std::pair<uint64_t, uint64_t> identity;
+#ifdef PLATFORM_WINDOWS
+        bool known = directory_identity(relative.empty() ? path : Path::join(path, relative), identity);
+#else
+        bool known = directory_identity(rootFd, relative.empty() ? "." : relative.c_str(), identity);
+#endif
+        if (!known) return false;
+        std::lock_guard<std::mutex> visitedLock(visitedMutex);
+        return visited.insert(identity).second;
+    };
+    if (options.followSymlinks) first_visit("");
+
+    auto worker = [&]() {
+        std::vector<DirectoryEntry> entries;
+        std::vector<PendingDirectory> found;
+
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true)
+        {
+            condition.wait(lock, [&]() { return !pending.empty() || busy == 0; });
+            if (pending.empty()) break;
+
+            PendingDirectory directory = std::move(pending.back());
+            pending.pop_back();
+            busy++;
+            lock.unlock();
+
+            auto visit = [&](const char* name, EntryKind kind, bool isLink) {
+                std::string child = directory.path.empty() ? std::string(name) : directory.path + "/" + name;
+                if (kind == EntryKind::File)
+                {
+                    if (options.includeFiles && (!options.fileFilter || options.fileFilter(child)))
+                    {
+                        entries.push_back({ std::move(child), false });
+                    }
+                }
+                else if (kind == EntryKind::Directory)
+                {
+                    if (isLink && !options.followSymlinks) return;
+                    if (options.directoryFilter && !options.directoryFilter(child)) return;
+                    if (options.followSymlinks && !first_visit(child)) return;
+
+                    if (options.includeDirectories) entries.push_back({ child, true });
+                    if (directory.depth < options.maxDepth) found.push_back({ std::move(child), directory.depth + 1 });
+                }
+            };
+
+#ifdef PLATFORM_WINDOWS
+            std::string osPath = directory.path.empty() ? path : Path::join(path, directory.path);
+            scan_directory(osPath, visit);
+#else
+            scan_directory(rootFd, directory.path.empty() ? "." : directory.path.c_str(),
+                [&](int, const char* name, EntryKind kind, bool isLink) { visit(name, kind, isLink); });
+#endif
+
+            lock.lock();
+            busy--;
+            for (auto& dir : found) pending.push_back(std::move(dir));
+            if (!found.empty() || (pending.empty() && busy == 0)) condition.notify_all();
+            found.clear();
+        }
+
+        result.insert(result.end(), std::make_move_iterator(entries.begin()), std::make_move_iterator(entries.end()));
+    };
+
+    uint32_t threadCount = resolve_thread_count(options.threadCount);
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount - 1);
+    for (uint32_t i = 1; i < threadCount; i++) threads.emplace_back(worker);
+    worker();
+    for (auto& thread : threads) thread.join();
+
+#ifndef PLATFORM_WINDOWS
+    ::close(rootFd);
+#endif
+
+    std::sort(result.begin(), result.end(), [](const DirectoryEntry& a, const DirectoryEntry& b) {
+        return a.path < b.path;
+    });
+    return result;
+}
+
 std::string Directory::getCurrent() 
 {
     char buffer[1024];
@@ -387,13 +900,13 @@ std::string Directory::getExecutable()
 #ifdef PLATFORM_WINDOWS
     char buffer[MAX_PATH];
     GetModuleFileNameA(nullptr, buffer, MAX_PATH);
-    return Path::GetDirectory(buffer);
+    return std::string(Path::getDirectory(buffer));
 #else
     char buffer[1024];
     ssize_t len = readlink("/proc/self/exe", buffer, sizeof(buffer) - 1);
     if (len != -1) {
         buffer[len] = '\0';
-        return Path::getDirectory(buffer);
+        return std::string(Path::getDirectory(buffer));
     }
     return getCurrent();
 #endif
@@ -422,26 +935,616 @@ std::string Directory::getTemp()
 }
 
 
+// MappedFile Implementation
+
+MappedFile::MappedFile(const std::string& path, Mode mode)
+{
+    open(path, mode);
+}
+
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : m_data(other.m_data), m_size(other.m_size), m_mode(other.m_mode),
+      m_handle(other.m_handle), m_mapping(other.m_mapping)
+{
+    other.m_data = nullptr;
+    other.m_size = 0;
+    other.m_handle = -1;
+    other.m_mapping = 0;
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+    if (this != &other)
+    {
+        close();
+        m_data = other.m_data;
+        m_size = other.m_size;
+        m_mode = other.m_mode;
+        m_handle = other.m_handle;
+        m_mapping = other.m_mapping;
+        other.m_data = nullptr;
+        other.m_size = 0;
+        other.m_handle = -1;
+        other.m_mapping = 0;
+    }
+    return *this;
+}
+
+bool MappedFile::open(const std::string& path, Mode mode)
+{
+    close();
+    m_mode = mode;
+
+#ifdef PLATFORM_WINDOWS
+    DWORD access = mode == Mode::ReadWrite ? (GENERIC_READ | GENERIC_WRITE) : GENERIC_READ;
+    HANDLE file = CreateFileA(path.c_str(), access, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size)) {
+        CloseHandle(file);
+        return false;
+    }
+    m_handle = reinterpret_cast<intptr_t>(file);
+    uint64_t fileSize = static_cast<uint64_t>(size.QuadPart);
+#else
+    int fd = ::open(path.c_str(), mode == Mode::ReadWrite ? O_RDWR : O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+        ::close(fd);
+        return false;
+    }
+    m_handle = fd;
+    uint64_t fileSize = static_cast<uint64_t>(st.st_size);
+#endif
+
+    if (!map(fileSize)) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+bool MappedFile::create(const std::string& path, uint64_t size)
+{
+    close();
+    m_mode = Mode::ReadWrite;
+
+#ifdef PLATFORM_WINDOWS
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr,
+                              CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+    m_handle = reinterpret_cast<intptr_t>(file);
+
+    LARGE_INTEGER distance;
+    distance.QuadPart = static_cast<LONGLONG>(size);
+    if (!SetFilePointerEx(file, distance, nullptr, FILE_BEGIN) || !SetEndOfFile(file)) {
+        close();
+        return false;
+    }
+#else
+    int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) return false;
+    m_handle = fd;
+
+    if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        close();
+        return false;
+    }
+#endif
+
+    if (!map(size)) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+bool MappedFile::map(uint64_t size)
+{
+    m_size = size;
+    if (size == 0) return true;
+
+#ifdef PLATFORM_WINDOWS
+    bool writable = m_mode == Mode::ReadWrite;
+    HANDLE mapping = CreateFileMappingA(reinterpret_cast<HANDLE>(m_handle), nullptr,
+                                        writable ? PAGE_READWRITE : PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) return false;
+    m_mapping = reinterpret_cast<intptr_t>(mapping);
+
+    void* view = MapViewOfFile(mapping, writable ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, 0);
+    if (!view) return false;
+#else
+    int prot = m_mode == Mode::ReadWrite ? (PROT_READ | PROT_WRITE) : PROT_READ;
+    int flags = m_mode == Mode::ReadWrite ? MAP_SHARED : MAP_PRIVATE;
+    void* view = mmap(nullptr, static_cast<size_t>(size), prot, flags, static_cast<int>(m_handle), 0);
+    if (view == MAP_FAILED) return false;
+#endif
+
+    m_data = static_cast<uint8_t*>(view);
+    return true;
+}
+
+void MappedFile::close()
+{
+#ifdef PLATFORM_WINDOWS
+    if (m_data) UnmapViewOfFile(m_data);
+    if (m_mapping) CloseHandle(reinterpret_cast<HANDLE>(m_mapping));
+    if (m_handle != -1) CloseHandle(reinterpret_cast<HANDLE>(m_handle));
+#else
+    if (m_data) munmap(m_data, static_cast<size_t>(m_size));
+    if (m_handle != -1) ::close(static_cast<int>(m_handle));
+#endif
+
+    m_data = nullptr;
+    m_size = 0;
+    m_handle = -1;
+    m_mapping = 0;
+}
+
+bool MappedFile::flush(bool async)
+{
+    if (!m_data || m_mode != Mode::ReadWrite) return false;
+
+#ifdef PLATFORM_WINDOWS
+    if (!FlushViewOfFile(m_data, 0)) return false;
+    return async || FlushFileBuffers(reinterpret_cast<HANDLE>(m_handle));
+#else
+    return msync(m_data, static_cast<size_t>(m_size), async ? MS_ASYNC : MS_SYNC) == 0;
+#endif
+}
+
+bool MappedFile::advise(Advice advice, uint64_t offset, uint64_t length) const
+{
+    if (!m_data || offset >= m_size) return false;
+    if (length == 0 || offset + length > m_size) length = m_size - offset;
+
+#ifdef PLATFORM_WINDOWS
+    if (advice != Advice::WillNeed) return true;
+    WIN32_MEMORY_RANGE_ENTRY range{ m_data + offset, static_cast<SIZE_T>(length) };
+    return PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+#else
+    int native = MADV_NORMAL;
+    switch (advice)
+    {
+        case Advice::Normal:     native = MADV_NORMAL; break;
+        case Advice::Sequential: native = MADV_SEQUENTIAL; break;
+        case Advice::Random:     native = MADV_RANDOM; break;
+        case Advice::WillNeed:   native = MADV_WILLNEED; break;
+        case Advice::DontNeed:   native = MADV_DONTNEED; break;
+    }
+
+    // madvise вимагає адресу, вирівняну по сторінці
+    static const uint64_t pageSize = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    uint64_t alignedOffset = offset & ~(pageSize - 1);
+    return madvise(m_data + alignedOffset, static_cast<size_t>(length + offset - alignedOffset), native) == 0;
+#endif
+}
+
+std::span<uint8_t> MappedFile::writableBytes()
+{
+    if (m_mode != Mode::ReadWrite) return {};
+    return { m_data, static_cast<size_t>(m_size) };
+}
+
+std::span<const uint8_t> MappedFile::slice(uint64_t offset, uint64_t length) const
+{
+    if (offset > m_size || length > m_size - offset) return {};
+    return { m_data + offset, static_cast<size_t>(length) };
+}
+
+
+// FileReader / FileWriter Implementation
+
+static void close_handle(intptr_t handle)
+{
+#ifdef PLATFORM_WINDOWS
+    CloseHandle(reinterpret_cast<HANDLE>(handle));
+#else
+    ::close(static_cast<int>(handle));
+#endif
+}
+
+/// Читає до size байтів; повертає -1 у разі помилки.
+static int64_t read_handle(intptr_t handle, void* data, size_t size)
+{
+#ifdef PLATFORM_WINDOWS
+    DWORD read = 0;
+    DWORD request = static_cast<DWORD>(std::min<size_t>(size, 1u << 30));
+    if (!ReadFile(reinterpret_cast<HANDLE>(handle), data, request, &read, nullptr)) return -1;
+    return read;
+#else
+    while (true)
+    {
+        ssize_t result = ::read(static_cast<int>(handle), data, size);
+        if (result < 0 && errno == EINTR) continue;
+        return result;
+    }
+#endif
+}
+
+static bool write_handle(intptr_t handle, const void* data, size_t size)
+{
+#ifdef PLATFORM_WINDOWS
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    while (size > 0)
+    {
+        DWORD written = 0;
+        DWORD request = static_cast<DWORD>(std::min<size_t>(size, 1u << 30));
+        if (!WriteFile(reinterpret_cast<HANDLE>(handle), bytes, request, &written, nullptr)) return false;
+        bytes += written;
+        size -= written;
+    }
+    return true;
+#else
+    return write_all(static_cast<int>(handle), static_cast<const uint8_t*>(data), size);
+#endif
+}
+
+static bool seek_handle(intptr_t handle, uint64_t offset)
+{
+#ifdef PLATFORM_WINDOWS
+    LARGE_INTEGER distance;
+    distance.QuadPart = static_cast<LONGLONG>(offset);
+    return SetFilePointerEx(reinterpret_cast<HANDLE>(handle), distance, nullptr, FILE_BEGIN) != 0;
+#else
+    return lseek(static_cast<int>(handle), static_cast<off_t>(offset), SEEK_SET) >= 0;
+#endif
+}
+
+FileReader::FileReader(size_t bufferSize)
+    : m_buffer(std::max<size_t>(bufferSize, 4096))
+{}
+
+FileReader::FileReader(const std::string& path, size_t bufferSize)
+    : FileReader(bufferSize)
+{
+    open(path);
+}
+
+FileReader::~FileReader()
+{
+    close();
+}
+
+FileReader::FileReader(FileReader&& other) noexcept
+    : m_buffer(std::move(other.m_buffer))
+    , m_bufferBegin(other.m_bufferBegin)
+    , m_bufferEnd(other.m_bufferEnd)
+    , m_position(other.m_position)
+    , m_size(other.m_size)
+    , m_handle(other.m_handle)
+{
+    other.m_handle = -1;
+    other.m_bufferBegin = other.m_bufferEnd = 0;
+}
+
+FileReader& FileReader::operator=(FileReader&& other) noexcept
+{
+    if (this != &other)
+    {
+        close();
+        m_buffer = std::move(other.m_buffer);
+        m_bufferBegin = other.m_bufferBegin;
+        m_bufferEnd = other.m_bufferEnd;
+        m_position = other.m_position;
+        m_size = other.m_size;
+        m_handle = other.m_handle;
+        other.m_handle = -1;
+        other.m_bufferBegin = other.m_bufferEnd = 0;
+    }
+    return *this;
+}
+
+bool FileReader::open(const std::string& path)
+{
+    close();
+
+#ifdef PLATFORM_WINDOWS
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size)) {
+        CloseHandle(file);
+        return false;
+    }
+    m_handle = reinterpret_cast<intptr_t>(file);
+    m_size = static_cast<uint64_t>(size.QuadPart);
+#else
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return false;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || S_ISDIR(st.st_mode)) {
+        ::close(fd);
+        return false;
+    }
+#ifdef PLATFORM_LINUX
+    posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+    m_handle = fd;
+    // Канали та спецфайли не мають розміру, їх читають до першого порожнього блоку
+    m_size = S_ISREG(st.st_mode) ? static_cast<uint64_t>(st.st_size) : 0;
+#endif
+
+    if (m_buffer.empty()) m_buffer.resize(k_defaultBufferSize);
+    m_position = 0;
+    m_bufferBegin = m_bufferEnd = 0;
+    return true;
+}
+
+void FileReader::close()
+{
+    if (m_handle != -1) close_handle(m_handle);
+    m_handle = -1;
+    m_position = m_size = 0;
+    m_bufferBegin = m_bufferEnd = 0;
+}
+
+size_t FileReader::fill()
+{
+    m_bufferBegin = m_bufferEnd = 0;
+    int64_t result = read_handle(m_handle, m_buffer.data(), m_buffer.size());
+    if (result <= 0) return 0;
+    m_bufferEnd = static_cast<size_t>(result);
+    return m_bufferEnd;
+}
+
+size_t FileReader::readDirect(void* data, size_t size)
+{
+    uint8_t* destination = static_cast<uint8_t*>(data);
+    size_t total = 0;
+    while (total < size)
+    {
+        int64_t result = read_handle(m_handle, destination + total, size - total);
+        if (result <= 0) break;
+        total += static_cast<size_t>(result);
+    }
+    return total;
+}
+
+size_t FileReader::read(void* data, size_t size)
+{
+    if (m_handle == -1 || size == 0) return 0;
+
+    uint8_t* destination = static_cast<uint8_t*>(data);
+    size_t total = 0;
+
+    size_t buffered = std::min(size, m_bufferEnd - m_bufferBegin);
+    if (buffered > 0)
+    {
+        std::memcpy(destination, m_buffer.data() + m_bufferBegin, buffered);
+        m_bufferBegin += buffered;
+        total += buffered;
+    }
+
+    size_t remaining = size - total;
+    if (remaining >= m_buffer.size())
+    {
+        // Великі читання йдуть одразу у пам'ять викликача; буфер уже вичерпано й він
+        // більше не відповідає позиції, тож seek() не повинен знаходити в ньому дані
+        total += readDirect(destination + total, remaining);
+        m_bufferBegin = m_bufferEnd = 0;
+    }
+    else if (remaining > 0 && fill() > 0)
+    {
+        size_t chunk = std::min(remaining, m_bufferEnd);
+        std::memcpy(destination + total, m_buffer.data(), chunk);
+        m_bufferBegin = chunk;
+        total += chunk;
+    }
+
+    m_position += total;
+    return total;
+}
+
+bool FileReader::readExact(void* data, size_t size)
+{
+    uint8_t* destination = static_cast<uint8_t*>(data);
+    size_t total = 0;
+    while (total < size)
+    {
+        size_t result = read(destination + total, size - total);
+        if (result == 0) return false;
+        total += result;
+    }
+    return true;
+}
+
+std::span<const uint8_t> FileReader::readChunk()
+{
+    if (m_handle == -1) return {};
+    if (m_bufferBegin == m_bufferEnd && fill() == 0) return {};
+
+    std::span<const uint8_t> chunk(m_buffer.data() + m_bufferBegin, m_bufferEnd - m_bufferBegin);
+    m_position += chunk.size();
+    m_bufferBegin = m_bufferEnd;
+    return chunk;
+}
+
+bool FileReader::seek(uint64_t offset)
+{
+    if (m_handle == -1) return false;
+
+    // Перехід у межах уже прочитаного буфера не звертається до ОС
+    uint64_t bufferStart = m_position - m_bufferBegin;
+    if (offset >= bufferStart && offset <= bufferStart + m_bufferEnd)
+    {
+        m_bufferBegin = static_cast<size_t>(offset - bufferStart);
+        m_position = offset;
+        return true;
+    }
+
+    if (!seek_handle(m_handle, offset)) return false;
+    m_bufferBegin = m_bufferEnd = 0;
+    m_position = offset;
+    return true;
+}
+
+FileWriter::FileWriter(size_t bufferSize)
+    : m_buffer(std::max<size_t>(bufferSize, 4096))
+{}
+
+FileWriter::FileWriter(const std::string& path, bool append, size_t bufferSize)
+    : FileWriter(bufferSize)
+{
+    open(path, append);
+}
+
+FileWriter::~FileWriter()
+{
+    close();
+}
+
+FileWriter::FileWriter(FileWriter&& other) noexcept
+    : m_buffer(std::move(other.m_buffer))
+    , m_buffered(other.m_buffered)
+    , m_position(other.m_position)
+    , m_handle(other.m_handle)
+    , m_failed(other.m_failed)
+{
+    other.m_handle = -1;
+    other.m_buffered = 0;
+}
+
+FileWriter& FileWriter::operator=(FileWriter&& other) noexcept
+{
+    if (this != &other)
+    {
+        close();
+        m_buffer = std::move(other.m_buffer);
+        m_buffered = other.m_buffered;
+        m_position = other.m_position;
+        m_handle = other.m_handle;
+        m_failed = other.m_failed;
+        other.m_handle = -1;
+        other.m_buffered = 0;
+    }
+    return *this;
+}
+
+bool FileWriter::open(const std::string& path, bool append)
+{
+    close();
+
+#ifdef PLATFORM_WINDOWS
+    HANDLE file = CreateFileA(path.c_str(), append ? FILE_APPEND_DATA : GENERIC_WRITE, 0, nullptr,
+                              append ? OPEN_ALWAYS : CREATE_ALWAYS, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER size{};
+    if (append) GetFileSizeEx(file, &size);
+    m_handle = reinterpret_cast<intptr_t>(file);
+    m_position = static_cast<uint64_t>(size.QuadPart);
+#else
+    int flags = O_WRONLY | O_CREAT | O_CLOEXEC | (append ? O_APPEND : O_TRUNC);
+    int fd = ::open(path.c_str(), flags, 0644);
+    if (fd < 0) return false;
+
+    struct stat st;
+    m_position = (append && fstat(fd, &st) == 0) ? static_cast<uint64_t>(st.st_size) : 0;
+    m_handle = fd;
+#endif
+
+    if (m_buffer.empty()) m_buffer.resize(k_defaultBufferSize);
+    m_buffered = 0;
+    m_failed = false;
+    return true;
+}
+
+bool FileWriter::writeDirect(const void* data, size_t size)
+{
+    if (!write_handle(m_handle, data, size)) m_failed = true;
+    return !m_failed;
+}
+
+bool FileWriter::write(const void* data, size_t size)
+{
+    if (m_handle == -1 || m_failed) return false;
+
+    const uint8_t* source = static_cast<const uint8_t*>(data);
+    m_position += size;
+
+    if (m_buffered + size <= m_buffer.size())
+    {
+        std::memcpy(m_buffer.data() + m_buffered, source, size);
+        m_buffered += size;
+        return true;
+    }
+
+    if (!flush()) return false;
+
+    // Великі записи передаються ОС без копіювання у буфер
+    if (size >= m_buffer.size()) return writeDirect(source, size);
+
+    std::memcpy(m_buffer.data(), source, size);
+    m_buffered = size;
+    return true;
+}
+
+bool FileWriter::flush()
+{
+    if (m_handle == -1 || m_failed) return false;
+    if (m_buffered == 0) return true;
+
+    bool success = writeDirect(m_buffer.data(), m_buffered);
+    m_buffered = 0;
+    return success;
+}
+
+bool FileWriter::close()
+{
+    if (m_handle == -1) return false;
+
+    bool success = flush();
+    close_handle(m_handle);
+    m_handle = -1;
+    m_buffered = 0;
+    return success && !m_failed;
+}
+
+
 // AsyncFile Implementation
 
-void AsyncFile::ReadBinaryAsync(const std::string& path, 
+IORequestId AsyncFile::ReadBinaryAsync(const std::string& path, 
                                 ReadCallback onSuccess,
-                                ErrorCallback onError) 
-{
-    std::thread([path, onSuccess, onError]() {
-        try {
-            auto data = File::readBinary(path);
-            if (data.empty() && onError) {
-                onError("Failed to read file: " + path);
-            } else if (onSuccess) {
-                onSuccess(std::move(data));
-            }
-        } catch (const std::exception& e) {
-            if (onError) {
-                onError(std::string("Exception: ") + e.what());
-            }
+                                ErrorCallback onError,
+                                IOPriority priority) 
+{
+    if (!File::isFile(path)) {
+        if (onError) {
+            onError("Failed to read file: " + path);
         }
-    }).detach();
-}
+        return 0;
+    }
 
+    auto data = std::make_shared<std::vector<uint8_t>>(File::getSize(path));
 
+    IOReadRequest request;
+    request.path = path;
+    request.size = data->size();
+    request.buffer = data->data();
+    request.priority = priority;
+    request.onComplete = [path, data, onSuccess, onError](const IOResult& result) {
+        if (result.status == IOStatus::Success) {
+            data->resize(static_cast<size_t>(result.bytesRead));
+            if (onSuccess) onSuccess(std::move(*data));
+        } else if (onError) {
+            onError(result.status == IOStatus::Cancelled
+                ? "Read cancelled: " + path
+                : "Failed to read file: " + path + " (" + std::strerror(result.error) + ")");
+        }
+    };
+
+    return AsyncIO::submit(std::move(request));
+}
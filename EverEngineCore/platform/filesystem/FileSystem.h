@@ -1,12 +1,21 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <vector>
+#include <span>
 #include <functional>
 #include <cstdint>
 
+#include "EverEngineCore/platform/filesystem/AsyncIO.h"
+
 /**
  * @brief Утилітний клас для роботи з шляхами файлів та директорій.
+ *
+ * Функції розбору (getDirectory, getFilename, ...) не виділяють пам'ять
+ * і повертають вигляд на частину вхідного рядка, тому результат валідний,
+ * доки живе вхідний рядок. Перевантаження normalize/join з параметром out
+ * записують результат у буфер викликача, перевикористовуючи його місткість.
  */
 class Path
 {
@@ -16,7 +25,22 @@ public:
      * @param path Вхідний шлях.
      * @return Нормалізований шлях.
      */
-    static std::string normalize(const std::string& path);
+    static std::string normalize(std::string_view path);
+
+    /**
+     * @brief Нормалізує шлях у буфер викликача.
+     * @param path Вхідний шлях.
+     * @param out Буфер для результату (попередній вміст замінюється).
+     */
+    static void normalize(std::string_view path, std::string& out);
+
+    /**
+     * @brief Приводить шлях до загального вигляду: роздільник '/', без "./",
+     *        повторних та кінцевого '/'. Використовується VFS та PathTable.
+     * @param path Вхідний шлях.
+     * @param out Буфер для результату (попередній вміст замінюється).
+     */
+    static void normalizeGeneric(std::string_view path, std::string& out);
 
     /**
      * @brief Об'єднує два шляхи в один.
@@ -24,49 +48,86 @@ public:
      * @param b Другий шлях.
      * @return Об'єднаний шлях.
      */
-    static std::string join(const std::string& a, const std::string& b);
+    static std::string join(std::string_view a, std::string_view b);
+
+    /**
+     * @brief Об'єднує два шляхи у буфер викликача.
+     * @param a Перший шлях.
+     * @param b Другий шлях.
+     * @param out Буфер для результату (попередній вміст замінюється).
+     */
+    static void join(std::string_view a, std::string_view b, std::string& out);
 
     /**
      * @brief Повертає директорію з повного шляху.
      * @param path Вхідний шлях.
-     * @return Директорія як рядок.
+     * @return Вигляд на директорію (порожній, якщо роздільника немає).
      */
-    static std::string getDirectory(const std::string& path);
+    static std::string_view getDirectory(std::string_view path);
 
     /**
      * @brief Повертає ім'я файлу з шляху.
      * @param path Вхідний шлях.
-     * @return Ім'я файлу.
+     * @return Вигляд на ім'я файлу.
      */
-    static std::string getFilename(const std::string& path);
+    static std::string_view getFilename(std::string_view path);
 
     /**
-     * @brief Повертає розширення файлу (без крапки).
+     * @brief Повертає розширення файлу (разом із крапкою).
      * @param path Вхідний шлях.
-     * @return Розширення файлу.
+     * @return Вигляд на розширення файлу.
      */
-    static std::string getExtention(const std::string& path);
+    static std::string_view getExtention(std::string_view path);
 
     /**
      * @brief Повертає ім'я файлу без розширення.
      * @param path Вхідний шлях.
-     * @return Ім'я файлу без розширення.
+     * @return Вигляд на ім'я файлу без розширення.
      */
-    static std::string getFilenameWithoutExtention(const std::string& path);
+    static std::string_view getFilenameWithoutExtention(std::string_view path);
 
     /**
      * @brief Перевіряє, чи є шлях абсолютним.
      * @param path Вхідний шлях.
      * @return true, якщо шлях абсолютний, інакше false.
      */
-    static bool isAbsolute(const std::string& path);
+    static bool isAbsolute(std::string_view path);
 
     /// Символ роздільника шляху (залежить від платформи)
     static const char separator;
 };
 
+/**
+ * @brief Тип об'єкта файлової системи.
+ */
+enum class FileType : uint8_t
+{
+    None,       ///< Об'єкт не існує або недоступний
+    File,       ///< Звичайний файл
+    Directory,  ///< Директорія
+    Other       ///< Канал, сокет, пристрій тощо
+};
+
+/**
+ * @brief Метадані файлу, отримані одним системним викликом.
+ */
+struct FileMetadata
+{
+    FileType type = FileType::None;
+    uint64_t size = 0;          ///< Розмір у байтах
+    uint64_t modified = 0;      ///< Час модифікації в одиницях File::getLastModifiedTime
+
+    bool exists() const { return type != FileType::None; }
+    bool isFile() const { return type == FileType::File; }
+    bool isDirectory() const { return type == FileType::Directory; }
+};
+
 /**
  * @brief Утилітний клас для роботи з файлами.
+ *
+ * Перевірки exists/isFile/isDirectory/getSize/getLastModifiedTime роблять
+ * один stat на виклик. Для частих повторних перевірок тих самих шляхів
+ * краще FileMetadataCache.
  */
 class File
 {
@@ -106,6 +167,14 @@ public:
      */
     static uint64_t getLastModifiedTime(const std::string& path);
 
+    /**
+     * @brief Зчитує тип, розмір та час модифікації одним викликом (statx на Linux).
+     * @param path Шлях до файлу або директорії.
+     * @param out Метадані (FileType::None, якщо об'єкт не існує).
+     * @return true, якщо об'єкт існує.
+     */
+    static bool getMetadata(const std::string& path, FileMetadata& out);
+
     /**
      * @brief Зчитує бінарні дані з файлу.
      * @param path Шлях до файлу.
@@ -122,6 +191,9 @@ public:
 
     /**
      * @brief Зчитує всі рядки файлу у вектор.
+     *
+     * Кінці рядків "\n" та "\r\n" відкидаються. Для великих файлів краще
+     * LineReader, який не копіює кожен рядок.
      * @param path Шлях до файлу.
      * @return Вектор рядків.
      */
@@ -161,9 +233,14 @@ public:
 
     /**
      * @brief Копіює файл.
+     *
+     * На Linux дані не проходять через процес: спершу пробується reflink
+     * (FICLONE), далі copy_file_range та sendfile. Якщо копіювання не
+     * вдалося повністю, частковий файл призначення видаляється.
+     *
      * @param from Шлях джерела.
      * @param to Шлях призначення.
-     * @return true, якщо копіювання успішне.
+     * @return true, якщо скопійовано весь файл.
      */
     static bool copy(const std::string& from, const std::string& to);
 
@@ -184,8 +261,41 @@ public:
     static bool rename(const std::string& oldPath, const std::string& newPath);
 };
 
+/**
+ * @brief Елемент, знайдений під час обходу директорії.
+ */
+struct DirectoryEntry
+{
+    std::string path;           ///< Шлях відносно кореня обходу (роздільник '/')
+    bool isDirectory = false;   ///< true для директорії, false для файлу
+};
+
+/**
+ * @brief Параметри рекурсивного обходу Directory::walk.
+ *
+ * Фільтри викликаються з робочих потоків, тому мають бути потокобезпечними.
+ */
+struct DirectoryWalkOptions
+{
+    bool includeFiles = true;           ///< Додавати файли у результат
+    bool includeDirectories = false;    ///< Додавати директорії у результат
+    bool followSymlinks = false;        ///< Заходити у директорії за символьними посиланнями (кожну директорію - один раз)
+    uint32_t maxDepth = UINT32_MAX;     ///< Глибина обходу (0 - лише вміст кореня)
+    uint32_t threadCount = 0;           ///< Кількість потоків (0 - за кількістю ядер, 1 - у поточному потоці)
+
+    /// Повертає true, якщо файл потрібно додати у результат.
+    std::function<bool(std::string_view path)> fileFilter;
+
+    /// Повертає true, якщо директорію потрібно обійти (і додати у результат).
+    std::function<bool(std::string_view path)> directoryFilter;
+};
+
 /**
  * @brief Утилітний клас для роботи з директоріями.
+ *
+ * На POSIX перелік вмісту читається за один прохід readdir з типом із d_type,
+ * тож stat викликається лише для файлових систем, що не повідомляють тип
+ * (DT_UNKNOWN), та для символьних посилань.
  */
 class Directory
 {
@@ -234,12 +344,25 @@ public:
     static std::vector<std::string> listDirectories(const std::string& path);
 
     /**
-     * @brief Повертає список усіх об'єктів (файли + директорії).
+     * @brief Повертає список усіх об'єктів (спочатку файли, потім директорії) за один прохід.
      * @param path Шлях до директорії.
      * @return Вектор імен файлів та директорій.
      */
     static std::vector<std::string> listAll(const std::string& path);
 
+    /**
+     * @brief Рекурсивно обходить дерево директорій.
+     *
+     * Піддиректорії розподіляються між робочими потоками, а всі звернення
+     * до ОС виконуються відносно дескриптора кореня (openat), без збирання
+     * повних шляхів.
+     *
+     * @param path Шлях до кореня обходу.
+     * @param options Параметри обходу.
+     * @return Знайдені елементи, відсортовані за шляхом.
+     */
+    static std::vector<DirectoryEntry> walk(const std::string& path, const DirectoryWalkOptions& options = {});
+
     /**
      * @brief Повертає поточну робочу директорію.
      * @return Поточна директорія як рядок.
@@ -265,8 +388,333 @@ public:
     static std::string getTemp();
 };
 
+/**
+ * @brief RAII-обгортка над файлом, відображеним у пам'ять.
+ *
+ * На POSIX використовує mmap/madvise, на Windows - CreateFileMapping/MapViewOfFile.
+ * Дані читаються напряму зі сторінкового кешу ОС без проміжних копій,
+ * тому підходить для великих ресурсів (пакети ассетів, шейдери, меші).
+ *
+ * @code
+ * MappedFile file;
+ * if (file.open("assets/shaders/basic.vert"))
+ * {
+ *     file.advise(MappedFile::Advice::Sequential);
+ *     std::string_view source = file.text();
+ * }
+ * @endcode
+ */
+class MappedFile
+{
+public:
+    /**
+     * @brief Режим відображення.
+     */
+    enum class Mode
+    {
+        ReadOnly,   ///< Тільки читання (PROT_READ, MAP_PRIVATE)
+        ReadWrite   ///< Читання та запис зі збереженням у файл (MAP_SHARED)
+    };
+
+    /**
+     * @brief Підказки ядру щодо шаблону доступу (madvise).
+     */
+    enum class Advice
+    {
+        Normal,     ///< Типова поведінка
+        Sequential, ///< Послідовне читання, агресивний read-ahead
+        Random,     ///< Випадковий доступ, без read-ahead
+        WillNeed,   ///< Попереднє завантаження сторінок
+        DontNeed    ///< Сторінки більше не потрібні
+    };
+
+    MappedFile() = default;
+
+    /**
+     * @brief Відкриває та відображає файл.
+     * @param path Шлях до файлу.
+     * @param mode Режим відображення.
+     */
+    explicit MappedFile(const std::string& path, Mode mode = Mode::ReadOnly);
+
+    /**
+     * @brief Знімає відображення та закриває файл.
+     */
+    ~MappedFile();
+
+    /// Заборонено копіювання.
+    MappedFile(const MappedFile& other) = delete;
+    MappedFile& operator=(const MappedFile& other) = delete;
+
+    /// Дозволено переміщення.
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /**
+     * @brief Відкриває та відображає існуючий файл.
+     * @param path Шлях до файлу.
+     * @param mode Режим відображення.
+     * @return true, якщо відображення успішне (порожній файл теж вважається відкритим).
+     */
+    bool open(const std::string& path, Mode mode = Mode::ReadOnly);
+
+    /**
+     * @brief Створює (або обрізає) файл заданого розміру та відображає його для запису.
+     * @param path Шлях до файлу.
+     * @param size Розмір файлу в байтах.
+     * @return true, якщо створення та відображення успішні.
+     */
+    bool create(const std::string& path, uint64_t size);
+
+    /**
+     * @brief Знімає відображення та закриває файл.
+     */
+    void close();
+
+    /**
+     * @brief Синхронізує змінені сторінки з диском (лише для ReadWrite).
+     * @param async Якщо true, не чекає завершення запису.
+     * @return true, якщо синхронізація успішна.
+     */
+    bool flush(bool async = false);
+
+    /**
+     * @brief Передає ядру підказку щодо шаблону доступу до діапазону.
+     * @param advice Тип підказки.
+     * @param offset Зміщення від початку файлу.
+     * @param length Довжина діапазону (0 - до кінця файлу).
+     * @return true, якщо підказку прийнято.
+     */
+    bool advise(Advice advice, uint64_t offset = 0, uint64_t length = 0) const;
+
+    /**
+     * @brief Перевіряє, чи відкритий файл.
+     */
+    bool isOpen() const { return m_handle != -1; }
+
+    /**
+     * @brief Повертає розмір відображення в байтах.
+     */
+    uint64_t size() const { return m_size; }
+
+    /**
+     * @brief Повертає режим відображення.
+     */
+    Mode getMode() const { return m_mode; }
+
+    /**
+     * @brief Повертає вказівник на початок даних (nullptr для порожнього файлу).
+     */
+    const uint8_t* data() const { return m_data; }
+
+    /**
+     * @brief Повертає незмінний вигляд усього вмісту файлу.
+     */
+    std::span<const uint8_t> bytes() const { return { m_data, static_cast<size_t>(m_size) }; }
+
+    /**
+     * @brief Повертає змінний вигляд вмісту (порожній для ReadOnly).
+     */
+    std::span<uint8_t> writableBytes();
+
+    /**
+     * @brief Повертає підмасив байтів з перевіркою меж.
+     * @param offset Зміщення від початку файлу.
+     * @param length Довжина підмасиву.
+     * @return Порожній span, якщо діапазон виходить за межі файлу.
+     */
+    std::span<const uint8_t> slice(uint64_t offset, uint64_t length) const;
+
+    /**
+     * @brief Повертає вміст файлу як текст без копіювання.
+     */
+    std::string_view text() const { return { reinterpret_cast<const char*>(m_data), static_cast<size_t>(m_size) }; }
+
+private:
+    bool map(uint64_t size);
+
+    uint8_t* m_data = nullptr;      ///< Початок відображення.
+    uint64_t m_size = 0;            ///< Розмір відображення.
+    Mode m_mode = Mode::ReadOnly;   ///< Режим відображення.
+    intptr_t m_handle = -1;         ///< Дескриптор файлу (fd або HANDLE).
+    intptr_t m_mapping = 0;         ///< Об'єкт відображення (лише Windows).
+};
+
+/**
+ * @brief Буферизоване послідовне читання файлу блоками.
+ *
+ * Для файлів, які не варто завантажувати у пам'ять цілком. Під час
+ * відкриття ядру передається підказка послідовного читання
+ * (posix_fadvise / FILE_FLAG_SEQUENTIAL_SCAN), тож read-ahead працює
+ * агресивніше. Читання, більші за буфер, виконуються напряму у пам'ять
+ * викликача без проміжного копіювання.
+ *
+ * @code
+ * FileReader reader(4 * 1024 * 1024);
+ * if (reader.open("assets/level.bin"))
+ * {
+ *     for (auto chunk = reader.readChunk(); !chunk.empty(); chunk = reader.readChunk())
+ *         process(chunk);
+ * }
+ * @endcode
+ */
+class FileReader
+{
+public:
+    static constexpr size_t k_defaultBufferSize = 256 * 1024;
+
+    /**
+     * @param bufferSize Розмір внутрішнього буфера в байтах.
+     */
+    explicit FileReader(size_t bufferSize = k_defaultBufferSize);
+
+    /**
+     * @brief Відкриває файл для читання.
+     */
+    explicit FileReader(const std::string& path, size_t bufferSize = k_defaultBufferSize);
+
+    ~FileReader();
+
+    /// Заборонено копіювання.
+    FileReader(const FileReader& other) = delete;
+    FileReader& operator=(const FileReader& other) = delete;
+
+    /// Дозволено переміщення.
+    FileReader(FileReader&& other) noexcept;
+    FileReader& operator=(FileReader&& other) noexcept;
+
+    /**
+     * @brief Відкриває файл для читання.
+     * @return true, якщо файл відкрито.
+     */
+    bool open(const std::string& path);
+
+    /**
+     * @brief Закриває файл.
+     */
+    void close();
+
+    /**
+     * @brief Читає до size байтів.
+     * @return Кількість прочитаних байтів (0 - кінець файлу або помилка).
+     */
+    size_t read(void* data, size_t size);
+
+    /**
+     * @brief Читає рівно size байтів.
+     * @return false, якщо файл закінчився раніше.
+     */
+    bool readExact(void* data, size_t size);
+
+    /**
+     * @brief Повертає наступний блок даних з внутрішнього буфера без копіювання.
+     *
+     * Вигляд валідний до наступного виклику будь-якого методу читання.
+     * @return Порожній вигляд у кінці файлу.
+     */
+    std::span<const uint8_t> readChunk();
+
+    /**
+     * @brief Переходить до позиції від початку файлу.
+     */
+    bool seek(uint64_t offset);
+
+    bool isOpen() const { return m_handle != -1; }
+    uint64_t tell() const { return m_position; }
+    uint64_t size() const { return m_size; }        ///< 0 для каналів та спецфайлів
+    bool eof() const { return m_position >= m_size; }
+
+private:
+    size_t fill();
+    size_t readDirect(void* data, size_t size);
+
+    std::vector<uint8_t> m_buffer;
+    size_t m_bufferBegin = 0;       ///< Початок непрочитаних даних у буфері
+    size_t m_bufferEnd = 0;         ///< Кінець даних у буфері
+    uint64_t m_position = 0;        ///< Логічна позиція читання
+    uint64_t m_size = 0;
+    intptr_t m_handle = -1;
+};
+
+/**
+ * @brief Буферизований послідовний запис файлу.
+ *
+ * Дрібні записи накопичуються у буфері, великі передаються ОС напряму.
+ * Дані гарантовано записані після успішного flush() або close().
+ */
+class FileWriter
+{
+public:
+    static constexpr size_t k_defaultBufferSize = 256 * 1024;
+
+    /**
+     * @param bufferSize Розмір внутрішнього буфера в байтах.
+     */
+    explicit FileWriter(size_t bufferSize = k_defaultBufferSize);
+
+    /**
+     * @brief Відкриває файл для запису.
+     */
+    explicit FileWriter(const std::string& path, bool append = false, size_t bufferSize = k_defaultBufferSize);
+
+    /**
+     * @brief Записує залишок буфера та закриває файл.
+     */
+    ~FileWriter();
+
+    /// Заборонено копіювання.
+    FileWriter(const FileWriter& other) = delete;
+    FileWriter& operator=(const FileWriter& other) = delete;
+
+    /// Дозволено переміщення.
+    FileWriter(FileWriter&& other) noexcept;
+    FileWriter& operator=(FileWriter&& other) noexcept;
+
+    /**
+     * @brief Відкриває (створює або обрізає) файл для запису.
+     * @param path Шлях до файлу.
+     * @param append Якщо true, дописує у кінець існуючого файлу.
+     * @return true, якщо файл відкрито.
+     */
+    bool open(const std::string& path, bool append = false);
+
+    /**
+     * @brief Записує дані.
+     * @return false у разі помилки запису.
+     */
+    bool write(const void* data, size_t size);
+    bool write(std::span<const uint8_t> data) { return write(data.data(), data.size()); }
+    bool write(std::string_view text) { return write(text.data(), text.size()); }
+
+    /**
+     * @brief Передає вміст буфера ОС.
+     */
+    bool flush();
+
+    /**
+     * @brief Записує залишок буфера та закриває файл.
+     * @return false, якщо будь-який запис не вдався.
+     */
+    bool close();
+
+    bool isOpen() const { return m_handle != -1; }
+    uint64_t tell() const { return m_position; }
+
+private:
+    bool writeDirect(const void* data, size_t size);
+
+    std::vector<uint8_t> m_buffer;
+    size_t m_buffered = 0;
+    uint64_t m_position = 0;
+    intptr_t m_handle = -1;
+    bool m_failed = false;
+};
+
 /**
  * @brief Асинхронне зчитування файлів.
+ *
+ * Тонка обгортка над AsyncIO для читання цілого файлу у вектор.
+ * Колбеки викликаються в основному потоці з AsyncIO::dispatchCompletions().
  */
 class AsyncFile
 {
@@ -278,9 +726,12 @@ public:
      * @brief Асинхронне зчитування бінарного файлу.
      * @param path Шлях до файлу.
      * @param onSuccess Колбек, що викликається при успішному зчитуванні.
-     * @param onError Колбек, що викликається у випадку помилки.
+     * @param onError Колбек, що викликається у випадку помилки або скасування.
+     * @param priority Пріоритет запиту.
+     * @return Ідентифікатор запиту для AsyncIO::cancel (0, якщо файл недоступний).
      */
-    static void ReadBinaryAsync(const std::string& path,
+    static IORequestId ReadBinaryAsync(const std::string& path,
         ReadCallback onSuccess,
-        ErrorCallback onError = nullptr);
+        ErrorCallback onError = nullptr,
+        IOPriority priority = IOPriority::Normal);
 };
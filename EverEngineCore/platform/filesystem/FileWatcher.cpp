@@ -0,0 +1,444 @@
+#include "EverEngineCore/platform/filesystem/FileWatcher.h"
+#include "EverEngineCore/platform/filesystem/FileSystem.h"
+#include "EverEngineCore/platform/Platform.h"
+#include "EverEngineCore/core/Log.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#ifdef PLATFORM_LINUX
+#include <sys/inotify.h>
+#include <sys/eventfd.h>
+#include <poll.h>
+#include <unistd.h>
+#include <climits>
+#include <cstdlib>
+#endif
+
+using Clock = std::chrono::steady_clock;
+
+struct WatchSubscription
+{
+    WatchId id = 0;
+    std::string path;           ///< Канонічний шлях файлу або директорії
+    bool isDirectory = false;
+    bool recursive = false;
+    FileWatcher::Callback callback;
+};
+
+struct PendingFileChange
+{
+    FileAction action = FileAction::Modified;
+    Clock::time_point time;
+};
+
+static std::mutex s_mutex;
+static std::vector<WatchSubscription> s_subscriptions;
+static std::unordered_map<std::string, PendingFileChange> s_pending;
+static std::atomic<uint32_t> s_debounceMs{ 100 };
+static std::atomic<WatchId> s_nextId{ 1 };
+static std::atomic<bool> s_running{ false };
+
+static bool has_prefix(const std::string& path, const std::string& directory)
+{
+    return path.size() > directory.size() && path[directory.size()] == '/' && path.compare(0, directory.size(), directory) == 0;
+}
+
+/**
+ * @brief Чи підпадає шлях файлу під підписку.
+ */
+static bool matches(const WatchSubscription& subscription, const std::string& path)
+{
+    if (!subscription.isDirectory) return path == subscription.path;
+    if (!has_prefix(path, subscription.path)) return false;
+    return subscription.recursive || path.find('/', subscription.path.size() + 1) == std::string::npos;
+}
+
+/**
+ * @brief Об'єднує нову подію з уже відкладеною для того ж файлу (під s_mutex).
+ */
+static void queue_change(const std::string& path, FileAction action, Clock::time_point now)
+{
+    auto [it, inserted] = s_pending.try_emplace(path, PendingFileChange{ action, now });
+    if (inserted) return;
+
+    FileAction previous = it->second.action;
+    if (previous == FileAction::Added && action == FileAction::Removed)
+    {
+        // Тимчасовий файл, що прожив менше за інтервал debounce
+        s_pending.erase(it);
+        return;
+    }
+    if (previous == FileAction::Added) action = FileAction::Added;
+    else if (previous == FileAction::Removed && action != FileAction::Removed) action = FileAction::Modified;
+
+    it->second = PendingFileChange{ action, now };
+}
+
+#ifdef PLATFORM_LINUX
+
+static constexpr uint32_t k_watchMask = IN_CREATE | IN_DELETE | IN_MODIFY | IN_CLOSE_WRITE |
+    IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF | IN_ONLYDIR;
+
+static int s_inotify = -1;
+static int s_wakeFd = -1;
+static std::thread s_thread;
+static std::unordered_map<int, std::string> s_watchPaths;
+static std::unordered_map<std::string, int> s_pathWatches;
+
+static std::string canonical_path(const std::string& path)
+{
+    char buffer[PATH_MAX];
+    if (!realpath(path.c_str(), buffer)) return "";
+    return buffer;
+}
+
+/**
+ * @brief Додає inotify-спостереження за однією директорією (під s_mutex).
+ */
+static bool add_directory_watch(const std::string& directory)
+{
+    if (s_pathWatches.count(directory)) return true;
+
+    int wd = inotify_add_watch(s_inotify, directory.c_str(), k_watchMask);
+    if (wd < 0)
+    {
+        LOG_ERROR("ERROR::FILE_WATCHER::ADD_WATCH->{}", directory);
+        return false;
+    }
+    s_watchPaths[wd] = directory;
+    s_pathWatches[directory] = wd;
+    return true;
+}
+
+/**
+ * @brief Додає спостереження за деревом директорій (під s_mutex).
+ * @param reportFiles Якщо true, файли, що вже є у дереві, повідомляються як Added
+ *                    (директорія з'явилась разом із вмістом, наприклад при копіюванні).
+ */
+static void add_tree_watch(const std::string& root, bool reportFiles, Clock::time_point now)
+{
+    if (!add_directory_watch(root)) return;
+
+    DirectoryWalkOptions options;
+    options.includeFiles = reportFiles;
+    options.includeDirectories = true;
+    options.threadCount = reportFiles ? 1 : 0;
+    for (const auto& entry : Directory::walk(root, options))
+    {
+        std::string path = root + "/" + entry.path;
+        if (entry.isDirectory) add_directory_watch(path);
+        else queue_change(path, FileAction::Added, now);
+    }
+}
+
+static void remove_directory_watch(const std::string& directory)
+{
+    auto it = s_pathWatches.find(directory);
+    if (it == s_pathWatches.end()) return;
+
+    inotify_rm_watch(s_inotify, it->second);
+    s_watchPaths.erase(it->second);
+    s_pathWatches.erase(it);
+}
+
+/**
+ * @brief Чи потрібне спостереження за директорією хоча б одній підписці (під s_mutex).
+ */
+static bool is_directory_needed(const std::string& directory)
+{
+    for (const auto& subscription : s_subscriptions)
+    {
+        if (!subscription.isDirectory)
+        {
+            if (Path::getDirectory(subscription.path) == directory) return true;
+        }
+        else if (subscription.path == directory || (subscription.recursive && has_prefix(directory, subscription.path)))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool is_recursively_watched(const std::string& directory)
+{
+    for (const auto& subscription : s_subscriptions)
+    {
+        if (subscription.isDirectory && subscription.recursive && has_prefix(directory, subscription.path)) return true;
+    }
+    return false;
+}
+
+static void handle_event(const inotify_event* event, Clock::time_point now)
+{
+    if (event->mask & IN_Q_OVERFLOW)
+    {
+        LOG_WARN("FILE_WATCHER::QUEUE_OVERFLOW");
+        return;
+    }
+
+    auto it = s_watchPaths.find(event->wd);
+    if (it == s_watchPaths.end()) return;
+
+    if (event->mask & (IN_IGNORED | IN_DELETE_SELF))
+    {
+        if (event->mask & IN_IGNORED)
+        {
+            s_pathWatches.erase(it->second);
+            s_watchPaths.erase(it);
+        }
+        return;
+    }
+    if (event->len == 0) return;
+
+    std::string path = it->second + "/" + event->name;
+
+    if (event->mask & IN_ISDIR)
+    {
+        if ((event->mask & (IN_CREATE | IN_MOVED_TO)) && is_recursively_watched(path))
+        {
+            add_tree_watch(path, true, now);
+        }
+        else if (event->mask & IN_MOVED_FROM)
+        {
+            // Дескриптори переміщеної директорії вказують на старі шляхи
+            std::vector<std::string> stale;
+            for (const auto& [directory, wd] : s_pathWatches)
+            {
+                if (directory == path || has_prefix(directory, path)) stale.push_back(directory);
+            }
+            for (const auto& directory : stale) remove_directory_watch(directory);
+        }
+        return;
+    }
+
+    FileAction action = FileAction::Modified;
+    if (event->mask & (IN_CREATE | IN_MOVED_TO)) action = FileAction::Added;
+    else if (event->mask & (IN_DELETE | IN_MOVED_FROM)) action = FileAction::Removed;
+    queue_change(path, action, now);
+}
+
+static void watch_thread()
+{
+    alignas(inotify_event) char buffer[64 * 1024];
+    pollfd fds[2] = {
+        { s_inotify, POLLIN, 0 },
+        { s_wakeFd, POLLIN, 0 }
+    };
+
+    while (s_running)
+    {
+        if (poll(fds, 2, -1) < 0) continue;
+        if (fds[1].revents & POLLIN) break;
+        if (!(fds[0].revents & POLLIN)) continue;
+
+        ssize_t length = read(s_inotify, buffer, sizeof(buffer));
+        if (length <= 0) continue;
+
+        Clock::time_point now = Clock::now();
+        std::lock_guard<std::mutex> lock(s_mutex);
+        for (char* ptr = buffer; ptr < buffer + length;)
+        {
+            const inotify_event* event = reinterpret_cast<const inotify_event*>(ptr);
+            handle_event(event, now);
+            ptr += sizeof(inotify_event) + event->len;
+        }
+    }
+}
+
+bool FileWatcher::init(uint32_t debounceMs)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (s_running) return true;
+
+    s_debounceMs = debounceMs;
+    s_inotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    s_wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (s_inotify < 0 || s_wakeFd < 0)
+    {
+        LOG_ERROR("ERROR::FILE_WATCHER::INIT");
+        if (s_inotify >= 0) close(s_inotify);
+        if (s_wakeFd >= 0) close(s_wakeFd);
+        s_inotify = s_wakeFd = -1;
+        return false;
+    }
+
+    s_running = true;
+    s_thread = std::thread(watch_thread);
+    LOG_INFO("FILE_WATCHER::INIT");
+    return true;
+}
+
+void FileWatcher::shutdown()
+{
+    if (!s_running) return;
+
+    s_running = false;
+    uint64_t value = 1;
+    (void)write(s_wakeFd, &value, sizeof(value));
+    if (s_thread.joinable()) s_thread.join();
+
+    std::lock_guard<std::mutex> lock(s_mutex);
+    close(s_inotify);
+    close(s_wakeFd);
+    s_inotify = s_wakeFd = -1;
+    s_watchPaths.clear();
+    s_pathWatches.clear();
+    s_subscriptions.clear();
+    s_pending.clear();
+    LOG_INFO("FILE_WATCHER::SHUTDOWN");
+}
+
+WatchId FileWatcher::watch(const std::string& path, Callback callback, bool recursive)
+{
+    if (!callback) return 0;
+    if (!s_running && !init(s_debounceMs)) return 0;
+
+    WatchSubscription subscription;
+    subscription.isDirectory = Directory::exists(path);
+    subscription.recursive = subscription.isDirectory && recursive;
+    subscription.callback = std::move(callback);
+
+    if (subscription.isDirectory)
+    {
+        subscription.path = canonical_path(path);
+    }
+    else
+    {
+        std::string parent(Path::getDirectory(path));
+        std::string directory = canonical_path(parent.empty() ? "." : parent);
+        if (!directory.empty()) subscription.path = directory.append("/").append(Path::getFilename(path));
+    }
+
+    if (subscription.path.empty())
+    {
+        LOG_ERROR("ERROR::FILE_WATCHER::INVALID_PATH->{}", path);
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (subscription.recursive)
+    {
+        add_tree_watch(subscription.path, false, Clock::now());
+    }
+    else if (!add_directory_watch(subscription.isDirectory ? subscription.path : std::string(Path::getDirectory(subscription.path))))
+    {
+        return 0;
+    }
+
+    subscription.id = s_nextId++;
+    s_subscriptions.push_back(std::move(subscription));
+    return s_subscriptions.back().id;
+}
+
+bool FileWatcher::unwatch(WatchId id)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    auto it = std::find_if(s_subscriptions.begin(), s_subscriptions.end(),
+        [id](const WatchSubscription& subscription) { return subscription.id == id; });
+    if (it == s_subscriptions.end()) return false;
+    s_subscriptions.erase(it);
+
+    std::vector<std::string> unused;
+    for (const auto& [directory, wd] : s_pathWatches)
+    {
+        if (!is_directory_needed(directory)) unused.push_back(directory);
+    }
+    for (const auto& directory : unused) remove_directory_watch(directory);
+    return true;
+}
+
+size_t FileWatcher::getWatchedDirectoryCount()
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    return s_pathWatches.size();
+}
+
+#else
+
+bool FileWatcher::init(uint32_t debounceMs)
+{
+    s_debounceMs = debounceMs;
+    LOG_WARN("FILE_WATCHER::UNSUPPORTED_PLATFORM");
+    return false;
+}
+
+void FileWatcher::shutdown()
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_subscriptions.clear();
+    s_pending.clear();
+}
+
+WatchId FileWatcher::watch(const std::string& path, Callback callback, bool recursive)
+{
+    (void)path; (void)callback; (void)recursive;
+    return 0;
+}
+
+bool FileWatcher::unwatch(WatchId id)
+{
+    (void)id;
+    return false;
+}
+
+size_t FileWatcher::getWatchedDirectoryCount()
+{
+    return 0;
+}
+
+#endif
+
+size_t FileWatcher::dispatch()
+{
+    std::vector<FileEvent> ready;
+    std::vector<std::pair<Callback, const FileEvent*>> calls;
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        if (s_pending.empty()) return 0;
+
+        Clock::time_point deadline = Clock::now() - std::chrono::milliseconds(s_debounceMs.load());
+        for (auto it = s_pending.begin(); it != s_pending.end();)
+        {
+            if (it->second.time > deadline)
+            {
+                ++it;
+                continue;
+            }
+            ready.push_back({ it->first, it->second.action });
+            it = s_pending.erase(it);
+        }
+
+        std::sort(ready.begin(), ready.end(), [](const FileEvent& a, const FileEvent& b) { return a.path < b.path; });
+        for (const auto& event : ready)
+        {
+            for (const auto& subscription : s_subscriptions)
+            {
+                if (matches(subscription, event.path)) calls.emplace_back(subscription.callback, &event);
+            }
+        }
+    }
+
+    // Колбеки викликаються без блокування, тож можуть змінювати підписки
+    for (const auto& [callback, event] : calls)
+    {
+        callback(*event);
+    }
+    return ready.size();
+}
+
+void FileWatcher::setDebounce(uint32_t milliseconds)
+{
+    s_debounceMs = milliseconds;
+}
+
+bool FileWatcher::isInitialized()
+{
+    return s_running;
+}
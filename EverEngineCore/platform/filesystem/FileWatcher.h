@@ -0,0 +1,104 @@
+#pragma once
+
+#include <string>
+#include <functional>
+#include <cstdint>
+#include <cstddef>
+
+/// Ідентифікатор підписки на зміни (0 - невалідна підписка).
+using WatchId = uint64_t;
+
+/**
+ * @brief Тип зміни файлу.
+ */
+enum class FileAction
+{
+    Added,      ///< Файл створено або переміщено у директорію
+    Modified,   ///< Вміст файлу змінено (або файл замінено атомарним збереженням)
+    Removed     ///< Файл видалено або переміщено з директорії
+};
+
+/**
+ * @brief Повідомлення про зміну файлу.
+ */
+struct FileEvent
+{
+    std::string path;                       ///< Канонічний абсолютний шлях до файлу
+    FileAction action = FileAction::Modified; ///< Тип зміни
+};
+
+/**
+ * @brief Спостерігач за змінами файлів на диску.
+ *
+ * На Linux використовує inotify: фоновий потік читає події, рекурсивно
+ * додає спостереження за новими піддиректоріями та об'єднує серії подій
+ * для одного файлу (наприклад, кілька записів або атомарне збереження
+ * редактором через тимчасовий файл). Повідомлення видаються лише після
+ * того, як файл не змінювався протягом інтервалу debounce, і лише в
+ * основному потоці з dispatch(), який Engine::run викликає щокадру.
+ * Повідомляються зміни файлів; зміни самих директорій не повідомляються.
+ *
+ * @code
+ * FileWatcher::watch("../assets/shaders", [](const FileEvent& event) {
+ *     LOG_INFO("changed: {}", event.path);
+ * });
+ * @endcode
+ */
+class FileWatcher
+{
+public:
+    using Callback = std::function<void(const FileEvent&)>;
+
+    /**
+     * @brief Запускає фоновий потік спостереження.
+     * @param debounceMs Інтервал тиші в мілісекундах перед видачею повідомлення.
+     * @return true, якщо спостерігач працює (false на платформах без підтримки).
+     */
+    static bool init(uint32_t debounceMs = 100);
+
+    /**
+     * @brief Зупиняє спостерігач та видаляє всі підписки.
+     */
+    static void shutdown();
+
+    /**
+     * @brief Підписується на зміни файлу або директорії.
+     *
+     * Для файлу спостереження встановлюється на батьківську директорію,
+     * тож підписка переживає видалення та повторне створення файлу.
+     * Якщо спостерігач не запущено, він запускається автоматично.
+     *
+     * @param path Шлях до файлу або директорії.
+     * @param callback Колбек, що викликається в основному потоці.
+     * @param recursive Для директорії - спостерігати також за піддиректоріями.
+     * @return Ідентифікатор підписки або 0 у разі помилки.
+     */
+    static WatchId watch(const std::string& path, Callback callback, bool recursive = true);
+
+    /**
+     * @brief Скасовує підписку.
+     * @return true, якщо підписку знайдено.
+     */
+    static bool unwatch(WatchId id);
+
+    /**
+     * @brief Викликає колбеки для змін, що пережили інтервал debounce.
+     * @return Кількість виданих подій.
+     */
+    static size_t dispatch();
+
+    /**
+     * @brief Змінює інтервал debounce.
+     */
+    static void setDebounce(uint32_t milliseconds);
+
+    /**
+     * @brief Перевіряє, чи запущений спостерігач.
+     */
+    static bool isInitialized();
+
+    /**
+     * @brief Повертає кількість директорій, за якими ведеться спостереження.
+     */
+    static size_t getWatchedDirectoryCount();
+};
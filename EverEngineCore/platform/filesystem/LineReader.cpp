@@ -0,0 +1,287 @@
+#include "EverEngineCore/platform/filesystem/LineReader.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <thread>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define LINE_READER_SSE2
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define LINE_READER_NEON
+#endif
+
+namespace
+{
+    /// Частини, менші за цей розмір, не варто віддавати окремому потоку.
+    constexpr size_t k_minParallelChunk = 256 * 1024;
+
+    /// Кількість частин на потік (для вирівнювання навантаження).
+    constexpr size_t k_chunksPerThread = 4;
+
+    void trim_carriage_return(std::string_view& line)
+    {
+        if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+    }
+
+#ifdef LINE_READER_NEON
+    /// Маска з 4 бітами на байт (аналог movemask для NEON).
+    uint64_t neon_mask(uint8x16_t equal)
+    {
+        uint8x8_t narrowed = vshrn_n_u16(vreinterpretq_u16_u8(equal), 4);
+        return vget_lane_u64(vreinterpret_u64_u8(narrowed), 0);
+    }
+#endif
+}
+
+LineReader::LineReader(std::string_view text)
+    : m_text(text)
+{}
+
+bool LineReader::open(const std::string& path)
+{
+    close();
+
+    if (m_file.open(path))
+    {
+        m_file.advise(MappedFile::Advice::Sequential);
+        m_text = m_file.text();
+        return true;
+    }
+
+    // Канали та файли, які не вдалося відобразити, читаються блоками
+    auto reader = std::make_unique<FileReader>();
+    if (!reader->open(path)) return false;
+
+    m_reader = std::move(reader);
+    m_chunked = true;
+    return true;
+}
+
+void LineReader::close()
+{
+    m_file.close();
+    m_reader.reset();
+    m_carry.clear();
+    m_text = {};
+    m_chunk = {};
+    m_position = 0;
+    m_lineNumber = 0;
+    m_chunked = false;
+}
+
+bool LineReader::next(std::string_view& line)
+{
+    if (m_chunked) return nextChunked(line);
+    if (m_position >= m_text.size()) return false;
+
+    const char* begin = m_text.data() + m_position;
+    const char* end = m_text.data() + m_text.size();
+    const char* newline = findNewline(begin, end);
+
+    size_t length = static_cast<size_t>(newline - begin);
+    m_position += length + (newline != end ? 1 : 0);
+
+    line = { begin, length };
+    trim_carriage_return(line);
+    m_lineNumber++;
+    return true;
+}
+
+bool LineReader::nextChunked(std::string_view& line)
+{
+    bool carried = false;
+    m_carry.clear();
+
+    while (true)
+    {
+        if (m_chunk.empty())
+        {
+            std::span<const uint8_t> chunk = m_reader->readChunk();
+            if (chunk.empty())
+            {
+                if (!carried) return false;
+
+                line = m_carry;
+                trim_carriage_return(line);
+                m_lineNumber++;
+                return true;
+            }
+            m_chunk = { reinterpret_cast<const char*>(chunk.data()), chunk.size() };
+        }
+
+        const char* end = m_chunk.data() + m_chunk.size();
+        const char* newline = findNewline(m_chunk.data(), end);
+        if (newline == end)
+        {
+            // Рядок продовжується у наступному блоці - буфер читача буде перезаписано
+            m_carry.append(m_chunk);
+            m_chunk = {};
+            carried = true;
+            continue;
+        }
+
+        size_t length = static_cast<size_t>(newline - m_chunk.data());
+        if (carried)
+        {
+            m_carry.append(m_chunk.data(), length);
+            line = m_carry;
+        }
+        else
+        {
+            line = { m_chunk.data(), length };
+        }
+        m_chunk.remove_prefix(length + 1);
+
+        trim_carriage_return(line);
+        m_lineNumber++;
+        return true;
+    }
+}
+
+const char* LineReader::findNewline(const char* begin, const char* end)
+{
+    const char* p = begin;
+
+#if defined(__AVX2__)
+    const __m256i newline = _mm256_set1_epi8('\n');
+    for (; end - p >= 32; p += 32)
+    {
+        __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+        uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, newline)));
+        if (mask != 0) return p + std::countr_zero(mask);
+    }
+#elif defined(LINE_READER_SSE2)
+    const __m128i newline = _mm_set1_epi8('\n');
+    for (; end - p >= 16; p += 16)
+    {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, newline)));
+        if (mask != 0) return p + std::countr_zero(mask);
+    }
+#elif defined(LINE_READER_NEON)
+    const uint8x16_t newline = vdupq_n_u8('\n');
+    for (; end - p >= 16; p += 16)
+    {
+        uint8x16_t block = vld1q_u8(reinterpret_cast<const uint8_t*>(p));
+        uint64_t mask = neon_mask(vceqq_u8(block, newline));
+        if (mask != 0) return p + (std::countr_zero(mask) >> 2);
+    }
+#endif
+
+    // Залишок (або вся вибірка без SIMD) - memchr у libc теж векторизований
+    const void* found = std::memchr(p, '\n', static_cast<size_t>(end - p));
+    return found ? static_cast<const char*>(found) : end;
+}
+
+uint64_t LineReader::countLines(std::string_view text)
+{
+    const char* p = text.data();
+    const char* end = p + text.size();
+    uint64_t count = 0;
+
+#if defined(__AVX2__)
+    const __m256i newline = _mm256_set1_epi8('\n');
+    for (; end - p >= 32; p += 32)
+    {
+        __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+        count += std::popcount(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, newline))));
+    }
+#elif defined(LINE_READER_SSE2)
+    const __m128i newline = _mm_set1_epi8('\n');
+    for (; end - p >= 16; p += 16)
+    {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        count += std::popcount(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, newline))));
+    }
+#elif defined(LINE_READER_NEON)
+    const uint8x16_t newline = vdupq_n_u8('\n');
+    for (; end - p >= 16; p += 16)
+    {
+        uint8x16_t block = vld1q_u8(reinterpret_cast<const uint8_t*>(p));
+        count += std::popcount(neon_mask(vceqq_u8(block, newline))) >> 2;
+    }
+#endif
+
+    count += static_cast<uint64_t>(std::count(p, end, '\n'));
+
+    // Останній рядок без '\n' теж рахується
+    if (!text.empty() && text.back() != '\n') count++;
+    return count;
+}
+
+std::vector<std::string_view> LineReader::split(std::string_view text, size_t chunkCount)
+{
+    std::vector<std::string_view> chunks;
+    if (text.empty()) return chunks;
+
+    chunkCount = std::clamp<size_t>(chunkCount, 1, text.size());
+    size_t target = text.size() / chunkCount;
+    const char* end = text.data() + text.size();
+
+    size_t begin = 0;
+    for (size_t i = 1; i < chunkCount && begin < text.size(); i++)
+    {
+        // Межа зсувається до кінця рядка, в який вона потрапила
+        size_t cut = std::max(begin, i * target);
+        const char* newline = findNewline(text.data() + cut, end);
+        if (newline == end) break;
+
+        size_t next = static_cast<size_t>(newline - text.data()) + 1;
+        chunks.push_back(text.substr(begin, next - begin));
+        begin = next;
+    }
+
+    if (begin < text.size()) chunks.push_back(text.substr(begin));
+    return chunks;
+}
+
+uint32_t LineReader::forEachParallel(std::string_view text, const ParallelCallback& callback, uint32_t threadCount)
+{
+    if (threadCount == 0) threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+    size_t chunkCount = std::clamp<size_t>(text.size() / k_minParallelChunk, 1, threadCount * k_chunksPerThread);
+    std::vector<std::string_view> chunks = split(text, chunkCount);
+
+    auto process = [&](size_t index) {
+        LineReader reader(chunks[index]);
+        std::string_view line;
+        while (reader.next(line)) callback(static_cast<uint32_t>(index), line);
+    };
+
+    size_t workers = std::min<size_t>(chunks.size(), threadCount);
+    if (workers <= 1)
+    {
+        for (size_t i = 0; i < chunks.size(); i++) process(i);
+        return static_cast<uint32_t>(chunks.size());
+    }
+
+    std::atomic<size_t> nextChunk{ 0 };
+    auto work = [&]() {
+        for (size_t i = nextChunk++; i < chunks.size(); i = nextChunk++) process(i);
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(workers - 1);
+    for (size_t i = 1; i < workers; i++) threads.emplace_back(work);
+    work();
+    for (auto& thread : threads) thread.join();
+
+    return static_cast<uint32_t>(chunks.size());
+}
+
+bool LineReader::forEachParallelInFile(const std::string& path, const ParallelCallback& callback, uint32_t threadCount)
+{
+    MappedFile file;
+    if (!file.open(path)) return false;
+
+    // Потоки читають різні ділянки одночасно, тож послідовний read-ahead не допоможе
+    file.advise(MappedFile::Advice::WillNeed);
+    forEachParallel(file.text(), callback, threadCount);
+    return true;
+}
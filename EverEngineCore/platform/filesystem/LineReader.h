@@ -0,0 +1,141 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <functional>
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+
+#include "EverEngineCore/platform/filesystem/FileSystem.h"
+
+/**
+ * @brief Потокове читання текстових файлів по рядках без алокацій на рядок.
+ *
+ * Регулярні файли відображаються у пам'ять (MappedFile), решта (канали,
+ * спецфайли) читається блоками через FileReader. Кінці рядків шукаються
+ * векторно (SSE2/AVX2/NEON, 16-32 байти за крок), а кожен рядок
+ * повертається як std::string_view без завершального "\n" та "\r".
+ * Семантика збігається з std::getline: останній рядок без "\n" теж
+ * повертається, а порожній файл не містить рядків.
+ *
+ * У відображеному режимі вигляди валідні, доки живе LineReader; у
+ * блоковому - лише до наступного виклику next().
+ *
+ * @code
+ * LineReader reader;
+ * if (reader.open("assets/data/items.csv"))
+ * {
+ *     std::string_view line;
+ *     while (reader.next(line))
+ *         parseItem(line);
+ * }
+ * @endcode
+ */
+class LineReader
+{
+public:
+    /**
+     * @brief Колбек паралельного обходу: номер частини та рядок.
+     *
+     * Частини пронумеровано у порядку слідування у файлі, тож результати
+     * можна зібрати у вихідному порядку.
+     */
+    using ParallelCallback = std::function<void(uint32_t chunk, std::string_view line)>;
+
+    LineReader() = default;
+
+    /**
+     * @brief Читає рядки із зовнішнього буфера (без копіювання).
+     */
+    explicit LineReader(std::string_view text);
+
+    /// Заборонено копіювання.
+    LineReader(const LineReader& other) = delete;
+    LineReader& operator=(const LineReader& other) = delete;
+
+    /// Дозволено переміщення.
+    LineReader(LineReader&& other) noexcept = default;
+    LineReader& operator=(LineReader&& other) noexcept = default;
+
+    /**
+     * @brief Відкриває файл для читання по рядках.
+     * @param path Шлях до файлу.
+     * @return true, якщо файл відкрито.
+     */
+    bool open(const std::string& path);
+
+    /**
+     * @brief Закриває файл.
+     */
+    void close();
+
+    /**
+     * @brief Повертає наступний рядок.
+     * @param line Рядок без символів кінця рядка.
+     * @return false, якщо рядки закінчились.
+     */
+    bool next(std::string_view& line);
+
+    /**
+     * @brief Повертає кількість уже прочитаних рядків.
+     */
+    uint64_t getLineNumber() const { return m_lineNumber; }
+
+    /**
+     * @brief Повертає весь текст (лише для відображеного режиму та буфера).
+     */
+    std::string_view text() const { return m_text; }
+
+    /**
+     * @brief Шукає перший '\n' у діапазоні [begin, end).
+     * @return Вказівник на '\n' або end.
+     */
+    static const char* findNewline(const char* begin, const char* end);
+
+    /**
+     * @brief Рахує кількість рядків у тексті (за семантикою next()).
+     */
+    static uint64_t countLines(std::string_view text);
+
+    /**
+     * @brief Ділить текст на частини приблизно однакового розміру за межами рядків.
+     * @param text Текст.
+     * @param chunkCount Бажана кількість частин.
+     * @return Частини; кожна закінчується після '\n' (крім, можливо, останньої).
+     */
+    static std::vector<std::string_view> split(std::string_view text, size_t chunkCount);
+
+    /**
+     * @brief Обходить рядки тексту на кількох потоках.
+     *
+     * Текст ділиться на частини за межами рядків, кожна частина обробляється
+     * одним потоком послідовно, тож колбек для різних частин викликається
+     * одночасно, а в межах частини - по порядку.
+     *
+     * @param text Текст.
+     * @param callback Колбек для кожного рядка.
+     * @param threadCount Кількість потоків (0 - за кількістю ядер).
+     * @return Кількість частин.
+     */
+    static uint32_t forEachParallel(std::string_view text, const ParallelCallback& callback, uint32_t threadCount = 0);
+
+    /**
+     * @brief Відображає файл та обходить його рядки на кількох потоках.
+     * @return false, якщо файл не вдалося відкрити.
+     */
+    static bool forEachParallelInFile(const std::string& path, const ParallelCallback& callback, uint32_t threadCount = 0);
+
+private:
+    bool nextChunked(std::string_view& line);
+
+    MappedFile m_file;
+    std::unique_ptr<FileReader> m_reader;   ///< Лише для блокового режиму
+    std::string m_carry;            ///< Рядок, що перетинає межу блоків
+    std::string_view m_text;        ///< Відображений текст або зовнішній буфер
+    std::string_view m_chunk;       ///< Непрочитана частина поточного блоку
+    size_t m_position = 0;
+    uint64_t m_lineNumber = 0;
+    bool m_chunked = false;
+};
@@ -0,0 +1,152 @@
+#include "EverEngineCore/platform/filesystem/PathTable.h"
+#include "EverEngineCore/platform/filesystem/FileSystem.h"
+#include "EverEngineCore/core/Hash.h"
+
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+#include <cstring>
+
+namespace
+{
+    struct PathRecord
+    {
+        std::string_view path;
+        uint64_t hash = 0;
+    };
+
+    constexpr size_t k_blockSize = 64 * 1024;
+    constexpr PathId k_emptySlot = UINT32_MAX;
+
+    std::shared_mutex s_mutex;
+    std::vector<std::unique_ptr<char[]>> s_blocks;  ///< Арена рядків (адреси стабільні)
+    char* s_currentBlock = nullptr;
+    size_t s_blockUsed = 0;
+    std::vector<PathRecord> s_records{ PathRecord{ {}, Hash::fnv1a64("") } };
+    std::vector<PathId> s_slots;                    ///< Відкрита адресація, індекс у s_records
+
+    /// Буфер нормалізації для поточного потоку (без алокацій після першого виклику).
+    std::string& scratch()
+    {
+        thread_local std::string buffer;
+        return buffer;
+    }
+
+    std::string_view store(std::string_view path)
+    {
+        // Довгі шляхи отримують окремий блок, щоб не марнувати залишок поточного
+        if (path.size() > k_blockSize / 4)
+        {
+            s_blocks.push_back(std::make_unique<char[]>(path.size()));
+            std::memcpy(s_blocks.back().get(), path.data(), path.size());
+            return { s_blocks.back().get(), path.size() };
+        }
+
+        if (!s_currentBlock || s_blockUsed + path.size() > k_blockSize)
+        {
+            s_blocks.push_back(std::make_unique<char[]>(k_blockSize));
+            s_currentBlock = s_blocks.back().get();
+            s_blockUsed = 0;
+        }
+
+        char* destination = s_currentBlock + s_blockUsed;
+        std::memcpy(destination, path.data(), path.size());
+        s_blockUsed += path.size();
+        return { destination, path.size() };
+    }
+
+    /// Шукає шлях у хеш-таблиці; викликається під блокуванням.
+    bool lookup(std::string_view path, uint64_t hash, PathId& out)
+    {
+        if (s_slots.empty()) return false;
+
+        size_t mask = s_slots.size() - 1;
+        for (size_t i = hash & mask;; i = (i + 1) & mask)
+        {
+            PathId id = s_slots[i];
+            if (id == k_emptySlot) return false;
+
+            const PathRecord& record = s_records[id];
+            if (record.hash == hash && record.path == path)
+            {
+                out = id;
+                return true;
+            }
+        }
+    }
+
+    void insert_slot(PathId id)
+    {
+        size_t mask = s_slots.size() - 1;
+        size_t i = s_records[id].hash & mask;
+        while (s_slots[i] != k_emptySlot) i = (i + 1) & mask;
+        s_slots[i] = id;
+    }
+
+    void grow()
+    {
+        s_slots.assign(s_slots.empty() ? 1024 : s_slots.size() * 2, k_emptySlot);
+        for (PathId id = 1; id < s_records.size(); id++)
+        {
+            insert_slot(id);
+        }
+    }
+}
+
+PathId PathTable::intern(std::string_view path)
+{
+    std::string& normalized = scratch();
+    Path::normalizeGeneric(path, normalized);
+    if (normalized.empty()) return 0;
+
+    uint64_t hash = Hash::fnv1a64(normalized);
+    PathId id = 0;
+    {
+        std::shared_lock lock(s_mutex);
+        if (lookup(normalized, hash, id)) return id;
+    }
+
+    std::unique_lock lock(s_mutex);
+    if (lookup(normalized, hash, id)) return id;
+
+    if ((s_records.size() + 1) * 4 > s_slots.size() * 3) grow();
+
+    id = static_cast<PathId>(s_records.size());
+    s_records.push_back({ store(normalized), hash });
+    insert_slot(id);
+    return id;
+}
+
+bool PathTable::find(std::string_view path, PathId& out)
+{
+    std::string& normalized = scratch();
+    Path::normalizeGeneric(path, normalized);
+    if (normalized.empty())
+    {
+        out = 0;
+        return true;
+    }
+
+    std::shared_lock lock(s_mutex);
+    return lookup(normalized, Hash::fnv1a64(normalized), out);
+}
+
+std::string_view PathTable::getPath(PathId id)
+{
+    std::shared_lock lock(s_mutex);
+    return id < s_records.size() ? s_records[id].path : std::string_view{};
+}
+
+uint64_t PathTable::getHash(PathId id)
+{
+    std::shared_lock lock(s_mutex);
+    return id < s_records.size() ? s_records[id].hash : 0;
+}
+
+size_t PathTable::getCount()
+{
+    std::shared_lock lock(s_mutex);
+    return s_records.size();
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <string_view>
+#include <cstdint>
+#include <cstddef>
+
+/// Ідентифікатор інтернованого шляху (0 - порожній шлях).
+using PathId = uint32_t;
+
+/**
+ * @brief Глобальна таблиця інтернованих шляхів.
+ *
+ * Кожен шлях приводиться до загального вигляду (Path::normalizeGeneric),
+ * зберігається один раз і отримує стабільний ідентифікатор, тож різні
+ * записи одного шляху ("shaders\\a.vert", "./shaders/a.vert") дають той
+ * самий PathId. Після інтернування шляхи порівнюються як цілі числа,
+ * а хеш (FNV-1a 64, той самий, що й у таблиці вмісту .pak) вже обчислено.
+ * Рядки ніколи не звільняються, тому отримані вигляди валідні до кінця програми.
+ *
+ * @code
+ * static const PathId basic = PathTable::intern("shaders/basic.vert");
+ * VirtualFileSystem::open(basic, file);
+ * @endcode
+ */
+class PathTable
+{
+public:
+    /**
+     * @brief Повертає ідентифікатор шляху, додаючи його у таблицю за потреби.
+     * @param path Шлях у довільному вигляді.
+     * @return Ідентифікатор (0 для порожнього шляху).
+     */
+    static PathId intern(std::string_view path);
+
+    /**
+     * @brief Шукає шлях без додавання.
+     * @param path Шлях у довільному вигляді.
+     * @param out Знайдений ідентифікатор.
+     * @return true, якщо шлях уже інтерновано.
+     */
+    static bool find(std::string_view path, PathId& out);
+
+    /**
+     * @brief Повертає нормалізований шлях за ідентифікатором.
+     * @return Вигляд на шлях (порожній для невідомого ідентифікатора).
+     */
+    static std::string_view getPath(PathId id);
+
+    /**
+     * @brief Повертає попередньо обчислений хеш шляху (Hash::fnv1a64).
+     */
+    static uint64_t getHash(PathId id);
+
+    /**
+     * @brief Повертає кількість інтернованих шляхів.
+     */
+    static size_t getCount();
+};
@@ -0,0 +1,483 @@
+#include "EverEngineCore/platform/filesystem/VirtualFileSystem.h"
+#include "EverEngineCore/platform/filesystem/FileMetadataCache.h"
+#include "EverEngineCore/core/Log.h"
+
+#include <algorithm>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_set>
+
+// VirtualFile
+
+void VirtualFile::reset()
+{
+    m_mapped.close();
+    m_owned.clear();
+    m_keepAlive = nullptr;
+    m_view = {};
+    m_valid = false;
+}
+
+void VirtualFile::setMapped(MappedFile&& file)
+{
+    reset();
+    m_mapped = std::move(file);
+    m_view = m_mapped.bytes();
+    m_valid = true;
+}
+
+void VirtualFile::setOwned(std::vector<uint8_t>&& data)
+{
+    reset();
+    m_owned = std::move(data);
+    m_view = m_owned;
+    m_valid = true;
+}
+
+void VirtualFile::setView(std::span<const uint8_t> view, std::shared_ptr<const void> keepAlive)
+{
+    reset();
+    m_keepAlive = std::move(keepAlive);
+    m_view = view;
+    m_valid = true;
+}
+
+
+// DirectoryMount
+
+DirectoryMount::DirectoryMount(const std::string& root)
+    : m_root(Path::normalize(root))
+{
+    refresh();
+}
+
+void DirectoryMount::refresh()
+{
+    m_files.clear();
+    for (auto& entry : Directory::walk(m_root))
+    {
+        m_files.insert(std::move(entry.path));
+    }
+    LOG_INFO("VFS::DIRECTORY::INDEXED->{} ({} files)", m_root, m_files.size());
+}
+
+bool DirectoryMount::exists(std::string_view path) const
+{
+    return m_files.find(path) != m_files.end();
+}
+
+uint64_t DirectoryMount::getSize(std::string_view path) const
+{
+    if (!exists(path)) return 0;
+    return FileMetadataCache::getSize(getOSPath(path));
+}
+
+bool DirectoryMount::open(std::string_view path, VirtualFile& out) const
+{
+    if (!exists(path)) return false;
+
+    MappedFile file;
+    if (!file.open(getOSPath(path))) return false;
+    out.setMapped(std::move(file));
+    return true;
+}
+
+void DirectoryMount::list(std::vector<std::string>& out) const
+{
+    out.insert(out.end(), m_files.begin(), m_files.end());
+}
+
+bool DirectoryMount::write(std::string_view path, const void* data, size_t size)
+{
+    std::string osPath = getOSPath(path);
+    std::string_view directory = Path::getDirectory(osPath);
+    if (!directory.empty() && !Directory::createRecursive(std::string(directory))) return false;
+    if (!File::writeBinary(osPath, data, size)) return false;
+
+    m_files.emplace(path);
+    return true;
+}
+
+std::string DirectoryMount::getOSPath(std::string_view path) const
+{
+    return Path::join(m_root, path);
+}
+
+
+// MemoryMount
+
+bool MemoryMount::exists(std::string_view path) const
+{
+    return m_files.find(path) != m_files.end();
+}
+
+uint64_t MemoryMount::getSize(std::string_view path) const
+{
+    auto it = m_files.find(path);
+    return it == m_files.end() ? 0 : it->second->size();
+}
+
+bool MemoryMount::open(std::string_view path, VirtualFile& out) const
+{
+    auto it = m_files.find(path);
+    if (it == m_files.end()) return false;
+
+    // Дані спільні: файл можна перезаписати, поки старий вигляд ще використовується
+    out.setView(*it->second, it->second);
+    return true;
+}
+
+void MemoryMount::list(std::vector<std::string>& out) const
+{
+    for (const auto& [path, data] : m_files)
+    {
+        out.push_back(path);
+    }
+}
+
+bool MemoryMount::write(std::string_view path, const void* data, size_t size)
+{
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    auto content = std::make_shared<const std::vector<uint8_t>>(bytes, bytes + size);
+
+    auto it = m_files.find(path);
+    if (it != m_files.end())
+    {
+        it->second = std::move(content);
+    }
+    else
+    {
+        m_files.emplace(std::string(path), std::move(content));
+    }
+    return true;
+}
+
+bool MemoryMount::remove(std::string_view path)
+{
+    auto it = m_files.find(path);
+    if (it == m_files.end()) return false;
+    m_files.erase(it);
+    return true;
+}
+
+
+// ArchiveMount
+
+ArchiveMount::ArchiveMount(std::shared_ptr<Archive> archive)
+    : m_archive(std::move(archive))
+{}
+
+
+// VirtualFileSystem
+
+namespace
+{
+    struct MountEntry
+    {
+        std::string point;                      ///< Нормалізована точка монтування ("" або "dir/")
+        std::shared_ptr<MountBackend> backend;
+        int priority = 0;
+        uint64_t order = 0;
+    };
+
+    struct Resolution
+    {
+        std::shared_ptr<MountBackend> backend;
+        size_t prefixLength = 0;
+    };
+
+    std::shared_mutex s_mutex;
+    std::vector<MountEntry> s_mounts;
+    std::unordered_map<PathId, Resolution> s_resolved;
+    uint64_t s_mountCounter = 0;
+    uint64_t s_generation = 0;              ///< Змінюється з кожною зміною монтувань або вмісту бекендів
+
+    bool is_os_path(std::string_view path)
+    {
+        return Path::isAbsolute(path) || path.starts_with("../");
+    }
+
+    /// Шукає бекенд для нормалізованого шляху; викликається під блокуванням.
+    bool find_backend(std::string_view path, Resolution& out)
+    {
+        for (const auto& mount : s_mounts)
+        {
+            if (!path.starts_with(mount.point)) continue;
+
+            std::string_view relative = path.substr(mount.point.size());
+            if (mount.backend->exists(relative))
+            {
+                out = { mount.backend, mount.point.size() };
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// Знаходить бекенд для шляху та викликає action(backend, relative) під спільним
+    /// блокуванням, щоб writeBinary/unmount не змінили бекенд посеред звернення.
+    /// Кешується лише знайдений файл (шлях інтернується тут, а не до пошуку), і лише
+    /// якщо монтування не змінились між блокуваннями. id 0 - шлях ще не інтерновано.
+    template<typename Action>
+    bool with_backend(PathId id, std::string_view path, Action&& action)
+    {
+        Resolution resolution;
+        uint64_t generation = 0;
+        bool stale = false;
+        {
+            std::shared_lock lock(s_mutex);
+            auto it = id != 0 ? s_resolved.find(id) : s_resolved.end();
+            if (it != s_resolved.end())
+            {
+                // Файл могли видалити з бекенду напряму (MemoryMount::remove):
+                // тоді шукаємо знову, щоб дістатися нижчого за пріоритетом монтування
+                std::string_view relative = path.substr(it->second.prefixLength);
+                if (it->second.backend->exists(relative))
+                {
+                    action(*it->second.backend, relative);
+                    return true;
+                }
+                stale = true;
+            }
+
+            generation = s_generation;
+            if (find_backend(path, resolution))
+            {
+                action(*resolution.backend, path.substr(resolution.prefixLength));
+            }
+            else if (!stale)
+            {
+                return false;
+            }
+        }
+
+        bool found = resolution.backend != nullptr;
+        if (found && id == 0) id = PathTable::intern(path);
+
+        std::unique_lock lock(s_mutex);
+        if (s_generation != generation) return found;
+        if (found) s_resolved.insert_or_assign(id, std::move(resolution));
+        else s_resolved.erase(id);
+        return found;
+    }
+
+    void invalidate_resolved()
+    {
+        s_resolved.clear();
+        s_generation++;
+    }
+
+    /// Викликає query(id, normalized) для шляху, не додаючи його у PathTable:
+    /// промахи та одноразові шляхи не мають залишатися у таблиці до кінця програми.
+    template<typename Query>
+    auto with_lookup_path(std::string_view path, Query&& query)
+    {
+        PathId id = 0;
+        if (PathTable::find(path, id)) return query(id, PathTable::getPath(id));
+
+        std::string normalized = VirtualFileSystem::normalize(path);
+        return query(PathId(0), std::string_view(normalized));
+    }
+
+    bool exists_at(PathId id, std::string_view path)
+    {
+        if (!is_os_path(path) && with_backend(id, path, [](const MountBackend&, std::string_view) {})) return true;
+        return FileMetadataCache::exists(path);
+    }
+
+    uint64_t get_size_at(PathId id, std::string_view path)
+    {
+        uint64_t size = 0;
+        auto action = [&size](const MountBackend& backend, std::string_view relative) { size = backend.getSize(relative); };
+        if (!is_os_path(path) && with_backend(id, path, action)) return size;
+        return FileMetadataCache::getSize(path);
+    }
+
+    bool open_at(PathId id, std::string_view path, VirtualFile& out)
+    {
+        bool opened = false;
+        auto action = [&](const MountBackend& backend, std::string_view relative) { opened = backend.open(relative, out); };
+        if (!is_os_path(path) && with_backend(id, path, action)) return opened;
+
+        MappedFile file;
+        if (!file.open(std::string(path))) return false;
+        out.setMapped(std::move(file));
+        return true;
+    }
+
+    std::string resolve_os_path_at(PathId id, std::string_view path)
+    {
+        std::string osPath;
+        auto action = [&osPath](const MountBackend& backend, std::string_view relative) { osPath = backend.getOSPath(relative); };
+        if (!is_os_path(path) && with_backend(id, path, action)) return osPath;
+        return std::string(path);
+    }
+}
+
+std::string VirtualFileSystem::normalize(std::string_view path)
+{
+    std::string result;
+    Path::normalizeGeneric(path, result);
+    return result;
+}
+
+bool VirtualFileSystem::mount(std::string_view mountPoint, std::shared_ptr<MountBackend> backend, int priority)
+{
+    if (!backend) return false;
+
+    std::string point = normalize(mountPoint);
+    if (!point.empty() && point != "/") point += '/';
+    if (point == "/") point.clear();
+
+    std::unique_lock lock(s_mutex);
+    LOG_INFO("VFS::MOUNT->'{}' ({}, priority {})", point, backend->getTypeName(), priority);
+    s_mounts.push_back({ std::move(point), std::move(backend), priority, s_mountCounter++ });
+    std::stable_sort(s_mounts.begin(), s_mounts.end(), [](const MountEntry& a, const MountEntry& b) {
+        return a.priority != b.priority ? a.priority > b.priority : a.order > b.order;
+    });
+    invalidate_resolved();
+    return true;
+}
+
+bool VirtualFileSystem::unmount(std::string_view mountPoint)
+{
+    std::string point = normalize(mountPoint);
+    if (!point.empty() && point != "/") point += '/';
+    if (point == "/") point.clear();
+
+    std::unique_lock lock(s_mutex);
+    size_t removed = std::erase_if(s_mounts, [&](const MountEntry& mount) { return mount.point == point; });
+    invalidate_resolved();
+    return removed > 0;
+}
+
+bool VirtualFileSystem::unmount(const std::shared_ptr<MountBackend>& backend)
+{
+    std::unique_lock lock(s_mutex);
+    size_t removed = std::erase_if(s_mounts, [&](const MountEntry& mount) { return mount.backend == backend; });
+    invalidate_resolved();
+    return removed > 0;
+}
+
+void VirtualFileSystem::unmountAll()
+{
+    std::unique_lock lock(s_mutex);
+    s_mounts.clear();
+    invalidate_resolved();
+}
+
+void VirtualFileSystem::refresh()
+{
+    std::unique_lock lock(s_mutex);
+    for (auto& mount : s_mounts)
+    {
+        mount.backend->refresh();
+    }
+    invalidate_resolved();
+}
+
+bool VirtualFileSystem::exists(std::string_view path)
+{
+    return with_lookup_path(path, [](PathId id, std::string_view normalized) { return exists_at(id, normalized); });
+}
+
+bool VirtualFileSystem::exists(PathId id)
+{
+    return exists_at(id, PathTable::getPath(id));
+}
+
+uint64_t VirtualFileSystem::getSize(std::string_view path)
+{
+    return with_lookup_path(path, [](PathId id, std::string_view normalized) { return get_size_at(id, normalized); });
+}
+
+uint64_t VirtualFileSystem::getSize(PathId id)
+{
+    return get_size_at(id, PathTable::getPath(id));
+}
+
+bool VirtualFileSystem::open(std::string_view path, VirtualFile& out)
+{
+    return with_lookup_path(path, [&out](PathId id, std::string_view normalized) { return open_at(id, normalized, out); });
+}
+
+bool VirtualFileSystem::open(PathId id, VirtualFile& out)
+{
+    return open_at(id, PathTable::getPath(id), out);
+}
+
+std::vector<uint8_t> VirtualFileSystem::readBinary(std::string_view path)
+{
+    VirtualFile file;
+    if (!open(path, file)) return {};
+    return { file.bytes().begin(), file.bytes().end() };
+}
+
+std::string VirtualFileSystem::readText(std::string_view path)
+{
+    VirtualFile file;
+    if (!open(path, file)) return "";
+    return std::string(file.text());
+}
+
+bool VirtualFileSystem::writeBinary(std::string_view path, const void* data, size_t size)
+{
+    std::string normalized = normalize(path);
+    if (!is_os_path(normalized))
+    {
+        std::unique_lock lock(s_mutex);
+        for (auto& mount : s_mounts)
+        {
+            if (!normalized.starts_with(mount.point)) continue;
+            if (mount.backend->write(normalized.substr(mount.point.size()), data, size))
+            {
+                // Генерація відкидає пошук, що паралельно знайшов старий бекенд
+                PathId id = 0;
+                if (PathTable::find(normalized, id)) s_resolved.erase(id);
+                s_generation++;
+                return true;
+            }
+        }
+    }
+    return File::writeBinary(normalized, data, size);
+}
+
+bool VirtualFileSystem::writeText(std::string_view path, std::string_view text)
+{
+    return writeBinary(path, text.data(), text.size());
+}
+
+std::string VirtualFileSystem::resolveOSPath(std::string_view path)
+{
+    return with_lookup_path(path, [](PathId id, std::string_view normalized) { return resolve_os_path_at(id, normalized); });
+}
+
+std::string VirtualFileSystem::resolveOSPath(PathId id)
+{
+    return resolve_os_path_at(id, PathTable::getPath(id));
+}
+
+std::vector<std::string> VirtualFileSystem::list(std::string_view directory)
+{
+    std::string prefix = normalize(directory);
+    if (!prefix.empty()) prefix += '/';
+
+    std::unordered_set<std::string> unique;
+    std::vector<std::string> entries;
+
+    std::shared_lock lock(s_mutex);
+    for (const auto& mount : s_mounts)
+    {
+        entries.clear();
+        mount.backend->list(entries);
+        for (auto& entry : entries)
+        {
+            std::string full = mount.point + entry;
+            if (full.starts_with(prefix)) unique.insert(std::move(full));
+        }
+    }
+
+    std::vector<std::string> result(unique.begin(), unique.end());
+    std::sort(result.begin(), result.end());
+    return result;
+}
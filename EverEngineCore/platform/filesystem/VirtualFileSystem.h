@@ -0,0 +1,295 @@
+#pragma once
+
+#include "EverEngineCore/platform/filesystem/FileSystem.h"
+#include "EverEngineCore/platform/filesystem/PathTable.h"
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <span>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * @brief Прозорий хеш для пошуку у контейнерах за std::string_view без алокацій.
+ */
+struct StringViewHash
+{
+    using is_transparent = void;
+    size_t operator()(std::string_view value) const { return std::hash<std::string_view>{}(value); }
+};
+
+/**
+ * @brief Вміст файлу, відкритого через VFS.
+ *
+ * Залежно від джерела дані або відображені у пам'ять (директорія),
+ * або є виглядом на вже завантажені байти (пам'ять, архів без стиснення),
+ * або належать об'єкту (розпаковані дані архіву). Для викликача різниці немає.
+ */
+class VirtualFile
+{
+public:
+    VirtualFile() = default;
+
+    /// Заборонено копіювання.
+    VirtualFile(const VirtualFile& other) = delete;
+    VirtualFile& operator=(const VirtualFile& other) = delete;
+
+    /// Дозволено переміщення.
+    VirtualFile(VirtualFile&& other) noexcept = default;
+    VirtualFile& operator=(VirtualFile&& other) noexcept = default;
+
+    /**
+     * @brief Перевіряє, чи відкритий файл.
+     */
+    bool isValid() const { return m_valid; }
+
+    /**
+     * @brief Повертає вміст файлу.
+     */
+    std::span<const uint8_t> bytes() const { return m_view; }
+
+    /**
+     * @brief Повертає вміст файлу як текст.
+     */
+    std::string_view text() const { return { reinterpret_cast<const char*>(m_view.data()), m_view.size() }; }
+
+    /**
+     * @brief Повертає розмір файлу в байтах.
+     */
+    uint64_t size() const { return m_view.size(); }
+
+    /**
+     * @brief Закриває файл та звільняє ресурси.
+     */
+    void reset();
+
+    /// @name Методи для бекендів
+    /// @{
+    void setMapped(MappedFile&& file);
+    void setOwned(std::vector<uint8_t>&& data);
+    void setView(std::span<const uint8_t> view, std::shared_ptr<const void> keepAlive = nullptr);
+    /// @}
+
+private:
+    MappedFile m_mapped;
+    std::vector<uint8_t> m_owned;
+    std::shared_ptr<const void> m_keepAlive;
+    std::span<const uint8_t> m_view;
+    bool m_valid = false;
+};
+
+/**
+ * @brief Джерело файлів, яке можна змонтувати у VirtualFileSystem.
+ *
+ * Усі шляхи відносні до точки монтування та вже нормалізовані
+ * (роздільник '/', без початкового '/').
+ */
+class MountBackend
+{
+public:
+    virtual ~MountBackend() = default;
+
+    virtual bool exists(std::string_view path) const = 0;
+    virtual uint64_t getSize(std::string_view path) const = 0;
+    virtual bool open(std::string_view path, VirtualFile& out) const = 0;
+
+    /**
+     * @brief Додає у out шляхи всіх файлів бекенду.
+     */
+    virtual void list(std::vector<std::string>& out) const = 0;
+
+    /**
+     * @brief Записує файл (лише для бекендів із підтримкою запису).
+     */
+    virtual bool write(std::string_view path, const void* data, size_t size) { (void)path; (void)data; (void)size; return false; }
+
+    /**
+     * @brief Повертає реальний шлях ОС для файлу або порожній рядок, якщо його немає.
+     */
+    virtual std::string getOSPath(std::string_view path) const { (void)path; return ""; }
+
+    /**
+     * @brief Перебудовує внутрішній індекс бекенду.
+     */
+    virtual void refresh() {}
+
+    virtual const char* getTypeName() const = 0;
+};
+
+/**
+ * @brief Бекенд над директорією ОС.
+ *
+ * Під час монтування один раз обходить дерево директорій (Directory::walk) і будує хеш-індекс
+ * файлів, тож подальші перевірки існування та розміру не звертаються до ОС.
+ * Файли, створені в обхід VFS, стають видимими після refresh().
+ */
+class DirectoryMount : public MountBackend
+{
+public:
+    explicit DirectoryMount(const std::string& root);
+
+    bool exists(std::string_view path) const override;
+    uint64_t getSize(std::string_view path) const override;
+    bool open(std::string_view path, VirtualFile& out) const override;
+    void list(std::vector<std::string>& out) const override;
+    bool write(std::string_view path, const void* data, size_t size) override;
+    std::string getOSPath(std::string_view path) const override;
+    void refresh() override;
+    const char* getTypeName() const override { return "Directory"; }
+
+    const std::string& getRoot() const { return m_root; }
+
+private:
+    std::string m_root;
+    std::unordered_set<std::string, StringViewHash, std::equal_to<>> m_files; ///< Відносні шляхи файлів
+};
+
+/**
+ * @brief Бекенд, що зберігає файли в оперативній пам'яті.
+ */
+class MemoryMount : public MountBackend
+{
+public:
+    bool exists(std::string_view path) const override;
+    uint64_t getSize(std::string_view path) const override;
+    bool open(std::string_view path, VirtualFile& out) const override;
+    void list(std::vector<std::string>& out) const override;
+    bool write(std::string_view path, const void* data, size_t size) override;
+    const char* getTypeName() const override { return "Memory"; }
+
+    /**
+     * @brief Видаляє файл з пам'яті.
+     */
+    bool remove(std::string_view path);
+
+private:
+    std::unordered_map<std::string, std::shared_ptr<const std::vector<uint8_t>>, StringViewHash, std::equal_to<>> m_files;
+};
+
+/**
+ * @brief Інтерфейс архіву ресурсів (пакований файл з таблицею вмісту).
+ */
+class Archive
+{
+public:
+    virtual ~Archive() = default;
+
+    virtual bool contains(std::string_view path) const = 0;
+    virtual uint64_t getSize(std::string_view path) const = 0;
+    virtual bool open(std::string_view path, VirtualFile& out) const = 0;
+    virtual void list(std::vector<std::string>& out) const = 0;
+};
+
+/**
+ * @brief Бекенд, що монтує архів (тільки читання).
+ */
+class ArchiveMount : public MountBackend
+{
+public:
+    explicit ArchiveMount(std::shared_ptr<Archive> archive);
+
+    bool exists(std::string_view path) const override { return m_archive->contains(path); }
+    uint64_t getSize(std::string_view path) const override { return m_archive->getSize(path); }
+    bool open(std::string_view path, VirtualFile& out) const override { return m_archive->open(path, out); }
+    void list(std::vector<std::string>& out) const override { m_archive->list(out); }
+    const char* getTypeName() const override { return "Archive"; }
+
+    const std::shared_ptr<Archive>& getArchive() const { return m_archive; }
+
+private:
+    std::shared_ptr<Archive> m_archive;
+};
+
+/**
+ * @brief Віртуальна файлова система з точками монтування.
+ *
+ * Віртуальний шлях (наприклад "assets/shaders/basic.vert") шукається у
+ * змонтованих бекендах у порядку спадання пріоритету; за однакового
+ * пріоритету перемагає пізніше змонтований. Знайдені файли кешуються
+ * у хеш-таблиці за PathId до наступної зміни монтувань, тож повторний
+ * пошук порівнює цілі числа, а не рядки; якщо файл зник з бекенду, пошук
+ * повторюється в решті монтувань. Шляхи, яких немає в жодному бекенді,
+ * не інтернуються. Перевантаження з PathId пропускають нормалізацію
+ * та хешування шляху. Якщо жоден бекенд не містить
+ * файл (або шлях абсолютний), використовується звичайна файлова система,
+ * тож існуючий код може переходити на VFS без змін у шляхах.
+ *
+ * @code
+ * VirtualFileSystem::mount("assets", std::make_shared<DirectoryMount>("../assets"));
+ * VirtualFileSystem::mount("assets", std::make_shared<ArchiveMount>(pak), 10);
+ * VirtualFile file;
+ * VirtualFileSystem::open("assets/shaders/basic.vert", file);
+ * @endcode
+ */
+class VirtualFileSystem
+{
+public:
+    /**
+     * @brief Монтує бекенд у точку монтування.
+     * @param mountPoint Віртуальний префікс ("" - корінь).
+     * @param backend Бекенд.
+     * @param priority Пріоритет (більший перевіряється раніше).
+     * @return true, якщо монтування успішне.
+     */
+    static bool mount(std::string_view mountPoint, std::shared_ptr<MountBackend> backend, int priority = 0);
+
+    /**
+     * @brief Відмонтовує всі бекенди з точки монтування.
+     * @return true, якщо хоча б один бекенд відмонтовано.
+     */
+    static bool unmount(std::string_view mountPoint);
+
+    /**
+     * @brief Відмонтовує конкретний бекенд.
+     */
+    static bool unmount(const std::shared_ptr<MountBackend>& backend);
+
+    /**
+     * @brief Відмонтовує всі бекенди.
+     */
+    static void unmountAll();
+
+    /**
+     * @brief Перебудовує індекси всіх бекендів та скидає кеш пошуку.
+     */
+    static void refresh();
+
+    static bool exists(std::string_view path);
+    static bool exists(PathId path);
+    static uint64_t getSize(std::string_view path);
+    static uint64_t getSize(PathId path);
+
+    /**
+     * @brief Відкриває файл для читання без зайвих копій.
+     * @return true, якщо файл знайдено.
+     */
+    static bool open(std::string_view path, VirtualFile& out);
+    static bool open(PathId path, VirtualFile& out);
+
+    static std::vector<uint8_t> readBinary(std::string_view path);
+    static std::string readText(std::string_view path);
+
+    /**
+     * @brief Записує файл у перший бекенд із підтримкою запису (або у файлову систему ОС).
+     */
+    static bool writeBinary(std::string_view path, const void* data, size_t size);
+    static bool writeText(std::string_view path, std::string_view text);
+
+    /**
+     * @brief Повертає шлях ОС для віртуального шляху або порожній рядок для архівів/пам'яті.
+     */
+    static std::string resolveOSPath(std::string_view path);
+    static std::string resolveOSPath(PathId path);
+
+    /**
+     * @brief Повертає віртуальні шляхи всіх файлів під директорією (без дублікатів).
+     */
+    static std::vector<std::string> list(std::string_view directory = "");
+
+    /**
+     * @brief Нормалізує віртуальний шлях: '/' як роздільник, без "./", повторних та кінцевих '/'.
+     */
+    static std::string normalize(std::string_view path);
+};
@@ -0,0 +1,130 @@
+#include "EverEngineCore/platform/filesystem/async/AsyncIOBackend.h"
+
+#include <algorithm>
+
+void IOQueue::push(std::vector<std::shared_ptr<IOTask>> tasks)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto& task : tasks)
+        {
+            m_pending[static_cast<size_t>(task->request.priority)].push_back(std::move(task));
+            m_pendingCount++;
+        }
+        if (m_wakeHandler) m_wakeHandler();
+    }
+    m_condition.notify_all();
+}
+
+std::shared_ptr<IOTask> IOQueue::pop(bool wait)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (wait)
+    {
+        m_condition.wait(lock, [this]() {
+            return m_closed || m_active.size() < m_pendingCount;
+        });
+    }
+    if (m_closed) return nullptr;
+
+    for (auto it = m_pending.rbegin(); it != m_pending.rend(); ++it)
+    {
+        if (it->empty()) continue;
+
+        std::shared_ptr<IOTask> task = std::move(it->front());
+        it->pop_front();
+        m_active[task->id] = task;
+        return task;
+    }
+    return nullptr;
+}
+
+bool IOQueue::cancel(IORequestId id)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto active = m_active.find(id);
+    if (active != m_active.end())
+    {
+        active->second->cancelled = true;
+        if (m_wakeHandler) m_wakeHandler();
+        return true;
+    }
+
+    for (auto& bucket : m_pending)
+    {
+        auto it = std::find_if(bucket.begin(), bucket.end(),
+            [id](const std::shared_ptr<IOTask>& task) { return task->id == id; });
+        if (it == bucket.end()) continue;
+
+        IOResult result;
+        result.id = id;
+        result.status = IOStatus::Cancelled;
+        m_completed.emplace_back(std::move(*it), result);
+        bucket.erase(it);
+        m_pendingCount--;
+        return true;
+    }
+    return false;
+}
+
+void IOQueue::complete(const std::shared_ptr<IOTask>& task, IOStatus status, uint64_t bytesRead, int error)
+{
+    IOResult result;
+    result.id = task->id;
+    result.status = task->cancelled ? IOStatus::Cancelled : status;
+    result.bytesRead = result.status == IOStatus::Cancelled ? 0 : bytesRead;
+    result.error = error;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_active.erase(task->id) == 0) return;
+    m_pendingCount--;
+    m_completed.emplace_back(task, result);
+}
+
+std::vector<std::pair<std::shared_ptr<IOTask>, IOResult>> IOQueue::takeCompleted(size_t maxCount)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_completed.size() <= maxCount)
+    {
+        return std::move(m_completed);
+    }
+
+    std::vector<std::pair<std::shared_ptr<IOTask>, IOResult>> batch(
+        std::make_move_iterator(m_completed.begin()),
+        std::make_move_iterator(m_completed.begin() + maxCount));
+    m_completed.erase(m_completed.begin(), m_completed.begin() + maxCount);
+    return batch;
+}
+
+void IOQueue::close()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_closed = true;
+        if (m_wakeHandler) m_wakeHandler();
+    }
+    m_condition.notify_all();
+}
+
+void IOQueue::reset()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto& bucket : m_pending) bucket.clear();
+    m_active.clear();
+    m_completed.clear();
+    m_pendingCount = 0;
+    m_closed = false;
+}
+
+void IOQueue::setWakeHandler(std::function<void()> handler)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_wakeHandler = std::move(handler);
+}
+
+size_t IOQueue::getPendingCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_pendingCount;
+}
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "EverEngineCore/platform/filesystem/AsyncIO.h"
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+/**
+ * @brief Внутрішній стан одного запиту.
+ */
+struct IOTask
+{
+    IORequestId id = 0;
+    IOReadRequest request;
+    std::atomic<bool> cancelled{ false };
+};
+
+/**
+ * @brief Спільна черга між AsyncIO та бекендами.
+ *
+ * Зберігає запити, що очікують (окремо для кожного пріоритету), запити,
+ * що виконуються (для скасування), та завершені результати, які
+ * віддаються в основний потік.
+ */
+class IOQueue
+{
+public:
+    /**
+     * @brief Додає задачі у чергу очікування.
+     */
+    void push(std::vector<std::shared_ptr<IOTask>> tasks);
+
+    /**
+     * @brief Забирає задачу з найвищим пріоритетом та позначає її як активну.
+     * @param wait Якщо true, блокує потік до появи задачі або закриття черги.
+     * @return Задача або nullptr, якщо черга порожня чи закрита.
+     */
+    std::shared_ptr<IOTask> pop(bool wait);
+
+    /**
+     * @brief Скасовує задачу за ідентифікатором.
+     * @return true, якщо задача ще не була завершена.
+     */
+    bool cancel(IORequestId id);
+
+    /**
+     * @brief Завершує активну задачу та ставить результат у чергу колбеків.
+     */
+    void complete(const std::shared_ptr<IOTask>& task, IOStatus status, uint64_t bytesRead, int error = 0);
+
+    /**
+     * @brief Забирає до maxCount готових результатів.
+     */
+    std::vector<std::pair<std::shared_ptr<IOTask>, IOResult>> takeCompleted(size_t maxCount);
+
+    /**
+     * @brief Закриває чергу та будить усі потоки, що чекають у pop().
+     */
+    void close();
+
+    /**
+     * @brief Відкриває чергу та очищує весь її стан.
+     */
+    void reset();
+
+    /**
+     * @brief Кількість задач, що очікують або виконуються.
+     */
+    size_t getPendingCount() const;
+
+    /**
+     * @brief Встановлює обробник пробудження бекенду.
+     *
+     * Викликається під м'ютексом черги після push(), cancel() активної задачі
+     * та close() — для бекендів, що чекають не на condition_variable,
+     * а, наприклад, у io_uring_enter. Порожній обробник вимикає пробудження.
+     */
+    void setWakeHandler(std::function<void()> handler);
+
+private:
+    mutable std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::array<std::deque<std::shared_ptr<IOTask>>, static_cast<size_t>(IOPriority::Count)> m_pending;
+    std::unordered_map<IORequestId, std::shared_ptr<IOTask>> m_active;
+    std::vector<std::pair<std::shared_ptr<IOTask>, IOResult>> m_completed;
+    std::function<void()> m_wakeHandler;
+    size_t m_pendingCount = 0;
+    bool m_closed = false;
+};
+
+/**
+ * @brief Інтерфейс бекенду асинхронного вводу/виводу.
+ *
+ * Бекенд забирає задачі з IOQueue, виконує читання та повідомляє
+ * про завершення через IOQueue::complete(). Він також відповідає за
+ * перевірку IOTask::cancelled для задач, що вже виконуються.
+ */
+class AsyncIOBackend
+{
+public:
+    virtual ~AsyncIOBackend() = default;
+
+    /**
+     * @brief Запускає робочі потоки бекенду.
+     * @param queue Черга задач.
+     * @param maxInFlight Максимальна кількість одночасних операцій.
+     * @return true, якщо бекенд готовий до роботи.
+     */
+    virtual bool start(IOQueue& queue, uint32_t maxInFlight) = 0;
+
+    /**
+     * @brief Зупиняє робочі потоки (черга вже закрита до виклику).
+     */
+    virtual void stop() = 0;
+
+    /**
+     * @brief Назва бекенду для логування.
+     */
+    virtual const char* getName() const = 0;
+};
@@ -0,0 +1,386 @@
+#include "EverEngineCore/platform/filesystem/async/IoUringBackend.h"
+#include "EverEngineCore/platform/Platform.h"
+#include "EverEngineCore/core/Log.h"
+
+#ifdef PLATFORM_LINUX
+#include <linux/io_uring.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <algorithm>
+
+/// user_data для службових SQE (скасування), чиї CQE ігноруються.
+static constexpr uint64_t k_internalUserData = ~0ull;
+/// user_data читання з eventfd пробудження.
+static constexpr uint64_t k_wakeUserData = ~0ull - 1;
+
+static int io_uring_setup(unsigned entries, io_uring_params* params)
+{
+    return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+static int io_uring_enter(int fd, unsigned toSubmit, unsigned minComplete, unsigned flags)
+{
+    return static_cast<int>(syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, nullptr, 0));
+}
+
+static int io_uring_register(int fd, unsigned opcode, void* arg, unsigned count)
+{
+    return static_cast<int>(syscall(__NR_io_uring_register, fd, opcode, arg, count));
+}
+
+static unsigned load_acquire(unsigned* ptr)
+{
+    return std::atomic_ref<unsigned>(*ptr).load(std::memory_order_acquire);
+}
+
+static void store_release(unsigned* ptr, unsigned value)
+{
+    std::atomic_ref<unsigned>(*ptr).store(value, std::memory_order_release);
+}
+
+IoUringBackend::~IoUringBackend()
+{
+    stop();
+    destroyRing();
+}
+
+bool IoUringBackend::isSupported()
+{
+    io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+    int fd = io_uring_setup(1, &params);
+    if (fd < 0) return false;
+
+    // Ядра 5.1-5.5 мають io_uring, але не IORING_OP_READ; без probe (< 5.6)
+    // вважаємо бекенд недоступним і падаємо на пул потоків.
+    constexpr unsigned k_probeOps = 256;
+    std::vector<uint8_t> storage(sizeof(io_uring_probe) + k_probeOps * sizeof(io_uring_probe_op), 0);
+    io_uring_probe* probe = reinterpret_cast<io_uring_probe*>(storage.data());
+    bool probed = io_uring_register(fd, IORING_REGISTER_PROBE, probe, k_probeOps) >= 0;
+    ::close(fd);
+    if (!probed) return false;
+
+    auto supported = [probe](unsigned op) {
+        return op <= probe->last_op && (probe->ops[op].flags & IO_URING_OP_SUPPORTED);
+    };
+    return supported(IORING_OP_READ) && supported(IORING_OP_ASYNC_CANCEL);
+}
+
+bool IoUringBackend::start(IOQueue& queue, uint32_t maxInFlight)
+{
+    maxInFlight = std::max(1u, maxInFlight);
+
+    // Кожна операція може додатково потребувати SQE для скасування
+    if (!setupRing(maxInFlight * 2))
+    {
+        LOG_WARN("ASYNC_IO::IO_URING::SETUP_FAILED->{}", errno);
+        destroyRing();
+        return false;
+    }
+
+    m_slots.assign(maxInFlight, Slot{});
+    m_freeSlots.clear();
+    for (uint32_t i = maxInFlight; i > 0; i--)
+    {
+        m_freeSlots.push_back(i - 1);
+    }
+
+    m_wakeFd = eventfd(0, EFD_CLOEXEC);
+    if (m_wakeFd < 0)
+    {
+        LOG_WARN("ASYNC_IO::IO_URING::EVENTFD_FAILED->{}", errno);
+        destroyRing();
+        return false;
+    }
+
+    m_queue = &queue;
+    queue.setWakeHandler([this]() { wake(); });
+
+    m_running = true;
+    m_thread = std::thread([this, &queue]() { loop(queue); });
+    return true;
+}
+
+void IoUringBackend::stop()
+{
+    m_running = false;
+    wake();
+    if (m_thread.joinable()) m_thread.join();
+
+    if (m_queue)
+    {
+        m_queue->setWakeHandler(nullptr);
+        m_queue = nullptr;
+    }
+}
+
+void IoUringBackend::wake()
+{
+    if (m_wakeFd < 0) return;
+    uint64_t one = 1;
+    ssize_t written = ::write(m_wakeFd, &one, sizeof(one));
+    (void)written;
+}
+
+bool IoUringBackend::setupRing(uint32_t entries)
+{
+    io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+    m_ringFd = io_uring_setup(entries, &params);
+    if (m_ringFd < 0) return false;
+
+    m_sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    m_cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    bool singleMmap = params.features & IORING_FEAT_SINGLE_MMAP;
+    if (singleMmap)
+    {
+        m_sqRingSize = m_cqRingSize = std::max(m_sqRingSize, m_cqRingSize);
+    }
+
+    m_sqRing = mmap(nullptr, m_sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd, IORING_OFF_SQ_RING);
+    if (m_sqRing == MAP_FAILED) { m_sqRing = nullptr; return false; }
+
+    if (singleMmap)
+    {
+        m_cqRing = m_sqRing;
+    }
+    else
+    {
+        m_cqRing = mmap(nullptr, m_cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd, IORING_OFF_CQ_RING);
+        if (m_cqRing == MAP_FAILED) { m_cqRing = nullptr; return false; }
+    }
+
+    m_sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+    void* sqes = mmap(nullptr, m_sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd, IORING_OFF_SQES);
+    if (sqes == MAP_FAILED) return false;
+    m_sqes = static_cast<io_uring_sqe*>(sqes);
+
+    uint8_t* sq = static_cast<uint8_t*>(m_sqRing);
+    m_sqHead = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+    m_sqTail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+    m_sqArray = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+    m_sqMask = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+    m_sqEntries = params.sq_entries;
+
+    uint8_t* cq = static_cast<uint8_t*>(m_cqRing);
+    m_cqHead = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+    m_cqTail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+    m_cqMask = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+    m_cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+    return true;
+}
+
+void IoUringBackend::destroyRing()
+{
+    if (m_sqes) munmap(m_sqes, m_sqesSize);
+    if (m_cqRing && m_cqRing != m_sqRing) munmap(m_cqRing, m_cqRingSize);
+    if (m_sqRing) munmap(m_sqRing, m_sqRingSize);
+    if (m_ringFd >= 0) ::close(m_ringFd);
+    if (m_wakeFd >= 0) ::close(m_wakeFd);
+
+    m_sqes = nullptr;
+    m_sqRing = m_cqRing = nullptr;
+    m_ringFd = -1;
+    m_wakeFd = -1;
+    m_wakeArmed = false;
+}
+
+io_uring_sqe* IoUringBackend::acquireSqe()
+{
+    unsigned tail = *m_sqTail;
+    if (tail - load_acquire(m_sqHead) >= m_sqEntries)
+    {
+        submit(0);
+        tail = *m_sqTail;
+    }
+
+    unsigned index = tail & m_sqMask;
+    io_uring_sqe* sqe = &m_sqes[index];
+    std::memset(sqe, 0, sizeof(*sqe));
+    m_sqArray[index] = index;
+    store_release(m_sqTail, tail + 1);
+    m_toSubmit++;
+    return sqe;
+}
+
+bool IoUringBackend::submit(unsigned minComplete)
+{
+    while (true)
+    {
+        int submitted = io_uring_enter(m_ringFd, m_toSubmit, minComplete, minComplete ? IORING_ENTER_GETEVENTS : 0);
+        if (submitted >= 0)
+        {
+            m_toSubmit -= std::min<unsigned>(m_toSubmit, static_cast<unsigned>(submitted));
+            return true;
+        }
+        if (errno != EINTR && errno != EAGAIN && errno != EBUSY)
+        {
+            LOG_ERROR("ASYNC_IO::IO_URING::ENTER_FAILED->{}", errno);
+            return false;
+        }
+    }
+}
+
+void IoUringBackend::prepareRead(uint32_t slotIndex)
+{
+    Slot& slot = m_slots[slotIndex];
+    const IOReadRequest& request = slot.task->request;
+
+    io_uring_sqe* sqe = acquireSqe();
+    sqe->opcode = IORING_OP_READ;
+    sqe->fd = slot.fd;
+    sqe->off = request.offset + slot.done;
+    sqe->addr = reinterpret_cast<uint64_t>(static_cast<uint8_t*>(request.buffer) + slot.done);
+    sqe->len = static_cast<uint32_t>(std::min<uint64_t>(request.size - slot.done, 1u << 30));
+    sqe->user_data = slotIndex;
+}
+
+void IoUringBackend::prepareCancel(uint32_t slotIndex)
+{
+    io_uring_sqe* sqe = acquireSqe();
+    sqe->opcode = IORING_OP_ASYNC_CANCEL;
+    sqe->fd = -1;
+    sqe->addr = slotIndex;
+    sqe->user_data = k_internalUserData;
+    m_slots[slotIndex].cancelIssued = true;
+}
+
+void IoUringBackend::prepareWakeRead()
+{
+    io_uring_sqe* sqe = acquireSqe();
+    sqe->opcode = IORING_OP_READ;
+    sqe->fd = m_wakeFd;
+    sqe->addr = reinterpret_cast<uint64_t>(&m_wakeValue);
+    sqe->len = sizeof(m_wakeValue);
+    sqe->user_data = k_wakeUserData;
+    m_wakeArmed = true;
+}
+
+void IoUringBackend::finish(IOQueue& queue, uint32_t slotIndex, IOStatus status, int error)
+{
+    Slot& slot = m_slots[slotIndex];
+    ::close(slot.fd);
+    queue.complete(slot.task, status, slot.done, error);
+
+    slot = Slot{};
+    m_freeSlots.push_back(slotIndex);
+    m_inFlight--;
+}
+
+void IoUringBackend::reapCompletions(IOQueue& queue)
+{
+    unsigned head = *m_cqHead;
+    while (head != load_acquire(m_cqTail))
+    {
+        const io_uring_cqe& cqe = m_cqes[head & m_cqMask];
+        uint64_t userData = cqe.user_data;
+        int res = cqe.res;
+        head++;
+
+        if (userData == k_internalUserData) continue;
+        if (userData == k_wakeUserData)
+        {
+            m_wakeArmed = false;
+            continue;
+        }
+
+        uint32_t slotIndex = static_cast<uint32_t>(userData);
+        Slot& slot = m_slots[slotIndex];
+
+        if (res == -ECANCELED || (slot.task->cancelled && res >= 0))
+        {
+            finish(queue, slotIndex, IOStatus::Cancelled, 0);
+        }
+        else if (res == -EINTR || res == -EAGAIN)
+        {
+            prepareRead(slotIndex);
+        }
+        else if (res < 0)
+        {
+            finish(queue, slotIndex, IOStatus::Error, -res);
+        }
+        else
+        {
+            slot.done += static_cast<uint64_t>(res);
+            if (res == 0 || slot.done >= slot.task->request.size)
+            {
+                finish(queue, slotIndex, IOStatus::Success, 0);
+            }
+            else
+            {
+                // Коротке читання: дочитуємо решту тим самим слотом
+                prepareRead(slotIndex);
+            }
+        }
+    }
+    store_release(m_cqHead, head);
+}
+
+void IoUringBackend::loop(IOQueue& queue)
+{
+    while (true)
+    {
+        while (!m_freeSlots.empty())
+        {
+            std::shared_ptr<IOTask> task = queue.pop(false);
+            if (!task) break;
+
+            int fd = ::open(task->request.path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (fd < 0)
+            {
+                queue.complete(task, IOStatus::Error, 0, errno);
+                continue;
+            }
+
+            uint32_t slotIndex = m_freeSlots.back();
+            m_freeSlots.pop_back();
+            m_slots[slotIndex].task = std::move(task);
+            m_slots[slotIndex].fd = fd;
+            m_inFlight++;
+
+            if (m_slots[slotIndex].task->request.size == 0)
+            {
+                finish(queue, slotIndex, IOStatus::Success, 0);
+                continue;
+            }
+            prepareRead(slotIndex);
+        }
+
+        for (uint32_t i = 0; i < m_slots.size(); i++)
+        {
+            Slot& slot = m_slots[i];
+            if (slot.task && !slot.cancelIssued && (slot.task->cancelled || !m_running))
+            {
+                prepareCancel(i);
+            }
+        }
+
+        if (!m_running && m_inFlight == 0) break;
+
+        // Чекаємо на будь-яке завершення: читання, скасування або eventfd
+        // пробудження (push/cancel/stop), тож нові запити не стоять у черзі.
+        if (!m_wakeArmed) prepareWakeRead();
+        if (!submit(1)) break;
+        reapCompletions(queue);
+    }
+
+    // Сюди з активними слотами потрапляємо лише після помилки io_uring_enter
+    for (uint32_t i = 0; i < m_slots.size(); i++)
+    {
+        if (m_slots[i].task) finish(queue, i, IOStatus::Error, EIO);
+    }
+}
+
+#else
+
+IoUringBackend::~IoUringBackend() {}
+bool IoUringBackend::isSupported() { return false; }
+bool IoUringBackend::start(IOQueue&, uint32_t) { return false; }
+void IoUringBackend::stop() {}
+
+#endif
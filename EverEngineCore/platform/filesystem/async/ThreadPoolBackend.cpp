@@ -0,0 +1,115 @@
+#include "EverEngineCore/platform/filesystem/async/ThreadPoolBackend.h"
+#include "EverEngineCore/platform/Platform.h"
+
+#include <algorithm>
+#include <cerrno>
+
+#ifdef PLATFORM_WINDOWS
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+/// Розмір блоку читання; між блоками перевіряється скасування.
+static constexpr uint64_t k_readChunkSize = 1u << 20;
+
+ThreadPoolBackend::ThreadPoolBackend(uint32_t workerCount)
+    : m_workerCount(workerCount)
+{
+    if (m_workerCount == 0)
+    {
+        m_workerCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+}
+
+ThreadPoolBackend::~ThreadPoolBackend()
+{
+    stop();
+}
+
+bool ThreadPoolBackend::start(IOQueue& queue, uint32_t maxInFlight)
+{
+    uint32_t count = std::max(1u, std::min(m_workerCount, maxInFlight));
+    m_workers.reserve(count);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        m_workers.emplace_back([this, &queue]() { workerLoop(queue); });
+    }
+    return true;
+}
+
+void ThreadPoolBackend::stop()
+{
+    for (auto& worker : m_workers)
+    {
+        if (worker.joinable()) worker.join();
+    }
+    m_workers.clear();
+}
+
+void ThreadPoolBackend::workerLoop(IOQueue& queue)
+{
+    while (std::shared_ptr<IOTask> task = queue.pop(true))
+    {
+        const IOReadRequest& request = task->request;
+        uint8_t* buffer = static_cast<uint8_t*>(request.buffer);
+        uint64_t total = 0;
+        int error = 0;
+
+#ifdef PLATFORM_WINDOWS
+        HANDLE file = CreateFileA(request.path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                  OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            queue.complete(task, IOStatus::Error, 0, static_cast<int>(GetLastError()));
+            continue;
+        }
+
+        while (total < request.size && !task->cancelled)
+        {
+            uint64_t offset = request.offset + total;
+            OVERLAPPED overlapped{};
+            overlapped.Offset = static_cast<DWORD>(offset);
+            overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+
+            DWORD chunk = static_cast<DWORD>(std::min(k_readChunkSize, request.size - total));
+            DWORD bytes = 0;
+            if (!ReadFile(file, buffer + total, chunk, &bytes, &overlapped))
+            {
+                DWORD lastError = GetLastError();
+                if (lastError != ERROR_HANDLE_EOF) error = static_cast<int>(lastError);
+                break;
+            }
+            if (bytes == 0) break;
+            total += bytes;
+        }
+        CloseHandle(file);
+#else
+        int fd = ::open(request.path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+        {
+            queue.complete(task, IOStatus::Error, 0, errno);
+            continue;
+        }
+        posix_fadvise(fd, static_cast<off_t>(request.offset), static_cast<off_t>(request.size), POSIX_FADV_SEQUENTIAL);
+
+        while (total < request.size && !task->cancelled)
+        {
+            size_t chunk = static_cast<size_t>(std::min(k_readChunkSize, request.size - total));
+            ssize_t bytes = pread(fd, buffer + total, chunk, static_cast<off_t>(request.offset + total));
+            if (bytes < 0)
+            {
+                if (errno == EINTR) continue;
+                error = errno;
+                break;
+            }
+            if (bytes == 0) break;
+            total += static_cast<uint64_t>(bytes);
+        }
+        ::close(fd);
+#endif
+
+        queue.complete(task, error ? IOStatus::Error : IOStatus::Success, total, error);
+    }
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "EverEngineCore/platform/filesystem/async/AsyncIOBackend.h"
+
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Переносний бекенд: пул потоків з блокуючим позиційним читанням.
+ *
+ * Кожен потік виконує одну операцію за раз, тому кількість одночасних
+ * операцій дорівнює кількості потоків. Читання йде блоками, між якими
+ * перевіряється прапорець скасування.
+ */
+class ThreadPoolBackend : public AsyncIOBackend
+{
+public:
+    /**
+     * @param workerCount Кількість потоків (0 - за кількістю ядер).
+     */
+    explicit ThreadPoolBackend(uint32_t workerCount);
+    ~ThreadPoolBackend() override;
+
+    bool start(IOQueue& queue, uint32_t maxInFlight) override;
+    void stop() override;
+    const char* getName() const override { return "ThreadPool"; }
+
+private:
+    void workerLoop(IOQueue& queue);
+
+    uint32_t m_workerCount = 0;
+    std::vector<std::thread> m_workers;
+};
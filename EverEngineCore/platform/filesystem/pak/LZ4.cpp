@@ -0,0 +1,186 @@
+#include "EverEngineCore/platform/filesystem/pak/LZ4.h"
+
+#include <cstring>
+#include <vector>
+
+static constexpr size_t k_minMatch = 4;
+static constexpr size_t k_lastLiterals = 5;      ///< Останні 5 байтів завжди літерали
+static constexpr size_t k_matchSafeDistance = 12; ///< Останній збіг починається не пізніше ніж за 12 байтів до кінця
+static constexpr size_t k_maxOffset = 65535;
+static constexpr int k_hashBits = 12;
+
+static inline uint32_t read32(const uint8_t* ptr)
+{
+    uint32_t value;
+    std::memcpy(&value, ptr, sizeof(value));
+    return value;
+}
+
+static inline uint32_t hash_sequence(uint32_t sequence)
+{
+    return (sequence * 2654435761u) >> (32 - k_hashBits);
+}
+
+static inline bool write_length(uint8_t*& op, const uint8_t* oend, size_t length)
+{
+    while (length >= 255)
+    {
+        if (op >= oend) return false;
+        *op++ = 255;
+        length -= 255;
+    }
+    if (op >= oend) return false;
+    *op++ = static_cast<uint8_t>(length);
+    return true;
+}
+
+static inline bool emit_sequence(uint8_t*& op, const uint8_t* oend,
+                                 const uint8_t* literals, size_t literalLength,
+                                 size_t offset, size_t matchLength)
+{
+    if (op >= oend) return false;
+    uint8_t* token = op++;
+    *token = static_cast<uint8_t>((literalLength >= 15 ? 15 : literalLength) << 4);
+    if (literalLength >= 15 && !write_length(op, oend, literalLength - 15)) return false;
+
+    if (static_cast<size_t>(oend - op) < literalLength) return false;
+    std::memcpy(op, literals, literalLength);
+    op += literalLength;
+
+    // Остання послідовність містить лише літерали
+    if (matchLength == 0) return true;
+
+    if (oend - op < 2) return false;
+    *op++ = static_cast<uint8_t>(offset & 0xFF);
+    *op++ = static_cast<uint8_t>(offset >> 8);
+
+    size_t encoded = matchLength - k_minMatch;
+    *token |= static_cast<uint8_t>(encoded >= 15 ? 15 : encoded);
+    if (encoded >= 15 && !write_length(op, oend, encoded - 15)) return false;
+    return true;
+}
+
+size_t LZ4::compress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstCapacity)
+{
+    uint8_t* op = dst;
+    const uint8_t* oend = dst + dstCapacity;
+    const uint8_t* anchor = src;
+
+    if (srcSize > k_matchSafeDistance)
+    {
+        // Позиції зберігаються зі зсувом +1, 0 означає порожню комірку
+        std::vector<uint32_t> table(size_t(1) << k_hashBits, 0);
+        const uint8_t* ip = src;
+        const uint8_t* matchStart = src + srcSize - k_matchSafeDistance;
+        const uint8_t* matchEnd = src + srcSize - k_lastLiterals;
+
+        while (ip < matchStart)
+        {
+            uint32_t sequence = read32(ip);
+            uint32_t& slot = table[hash_sequence(sequence)];
+            const uint8_t* ref = slot ? src + (slot - 1) : nullptr;
+            slot = static_cast<uint32_t>(ip - src) + 1;
+
+            if (!ref || static_cast<size_t>(ip - ref) > k_maxOffset || read32(ref) != sequence)
+            {
+                ip++;
+                continue;
+            }
+
+            // Розширюємо збіг назад, поки це не заходить у вже закодовані літерали
+            while (ip > anchor && ref > src && ip[-1] == ref[-1])
+            {
+                ip--;
+                ref--;
+            }
+
+            const uint8_t* scan = ip + k_minMatch;
+            const uint8_t* scanRef = ref + k_minMatch;
+            while (scan < matchEnd && *scan == *scanRef)
+            {
+                scan++;
+                scanRef++;
+            }
+
+            size_t matchLength = static_cast<size_t>(scan - ip);
+            if (!emit_sequence(op, oend, anchor, static_cast<size_t>(ip - anchor),
+                               static_cast<size_t>(ip - ref), matchLength))
+            {
+                return 0;
+            }
+
+            ip = scan;
+            anchor = ip;
+        }
+    }
+
+    size_t lastLiterals = static_cast<size_t>(src + srcSize - anchor);
+    if (!emit_sequence(op, oend, anchor, lastLiterals, 0, 0)) return 0;
+    return static_cast<size_t>(op - dst);
+}
+
+int64_t LZ4::decompress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstCapacity)
+{
+    const uint8_t* ip = src;
+    const uint8_t* iend = src + srcSize;
+    uint8_t* op = dst;
+    uint8_t* oend = dst + dstCapacity;
+
+    while (ip < iend)
+    {
+        uint8_t token = *ip++;
+
+        size_t literalLength = token >> 4;
+        if (literalLength == 15)
+        {
+            uint8_t extra;
+            do
+            {
+                if (ip >= iend) return -1;
+                extra = *ip++;
+                literalLength += extra;
+            } while (extra == 255);
+        }
+
+        if (static_cast<size_t>(iend - ip) < literalLength || static_cast<size_t>(oend - op) < literalLength) return -1;
+        std::memcpy(op, ip, literalLength);
+        ip += literalLength;
+        op += literalLength;
+
+        if (ip == iend) break;
+
+        if (iend - ip < 2) return -1;
+        size_t offset = static_cast<size_t>(ip[0]) | (static_cast<size_t>(ip[1]) << 8);
+        ip += 2;
+        if (offset == 0 || offset > static_cast<size_t>(op - dst)) return -1;
+
+        size_t matchLength = token & 15;
+        if (matchLength == 15)
+        {
+            uint8_t extra;
+            do
+            {
+                if (ip >= iend) return -1;
+                extra = *ip++;
+                matchLength += extra;
+            } while (extra == 255);
+        }
+        matchLength += k_minMatch;
+
+        if (static_cast<size_t>(oend - op) < matchLength) return -1;
+
+        // Збіг може перекриватися з результатом, тому копіюємо побайтово
+        const uint8_t* match = op - offset;
+        if (offset >= matchLength)
+        {
+            std::memcpy(op, match, matchLength);
+            op += matchLength;
+        }
+        else
+        {
+            for (size_t i = 0; i < matchLength; i++) *op++ = *match++;
+        }
+    }
+
+    return static_cast<int64_t>(op - dst);
+}
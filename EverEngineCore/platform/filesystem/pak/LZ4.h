@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Мінімальна реалізація блочного формату LZ4.
+ *
+ * Сумісна з LZ4 block format (без обгортки кадру), тож дані можна
+ * розпаковувати будь-якою сторонньою реалізацією LZ4. Стискач жадібний,
+ * з однією хеш-таблицею, розпаковувач перевіряє всі межі буферів.
+ */
+class LZ4
+{
+public:
+    /**
+     * @brief Максимальний розмір стиснених даних для вхідного блоку.
+     * @param size Розмір вхідних даних.
+     */
+    static size_t compressBound(size_t size) { return size + size / 255 + 16; }
+
+    /**
+     * @brief Стискає блок даних.
+     * @param src Вхідні дані.
+     * @param srcSize Розмір вхідних даних.
+     * @param dst Буфер результату (мінімум compressBound(srcSize) байтів).
+     * @param dstCapacity Розмір буфера результату.
+     * @return Розмір стиснених даних або 0 у разі нестачі місця.
+     */
+    static size_t compress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstCapacity);
+
+    /**
+     * @brief Розпаковує блок даних.
+     * @param src Стиснені дані.
+     * @param srcSize Розмір стиснених даних.
+     * @param dst Буфер результату.
+     * @param dstCapacity Розмір буфера результату.
+     * @return Кількість розпакованих байтів або -1 для пошкоджених даних.
+     */
+    static int64_t decompress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstCapacity);
+};
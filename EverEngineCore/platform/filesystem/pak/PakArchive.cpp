@@ -0,0 +1,222 @@
+#include "EverEngineCore/platform/filesystem/pak/PakArchive.h"
+#include "EverEngineCore/platform/filesystem/pak/LZ4.h"
+#include "EverEngineCore/core/Hash.h"
+#include "EverEngineCore/core/Log.h"
+
+#include <algorithm>
+#include <cstring>
+
+std::shared_ptr<PakArchive> PakArchive::load(const std::string& path)
+{
+    std::shared_ptr<PakArchive> archive(new PakArchive());
+    archive->m_path = path;
+
+    if (!archive->m_file.open(path))
+    {
+        LOG_ERROR("ERROR::PAK::OPEN->{}", path);
+        return nullptr;
+    }
+    if (!archive->validate())
+    {
+        LOG_ERROR("ERROR::PAK::CORRUPTED->{}", path);
+        return nullptr;
+    }
+
+    // Таблиці читаються випадково, а дані записів - послідовно
+    archive->m_file.advise(MappedFile::Advice::WillNeed, archive->m_header->chunkTableOffset);
+    LOG_INFO("PAK::LOADED->{} ({} entries)", path, archive->m_entries.size());
+    return archive;
+}
+
+bool PakArchive::validate()
+{
+    const uint64_t fileSize = m_file.size();
+    std::span<const uint8_t> headerBytes = m_file.slice(0, sizeof(PakHeader));
+    if (headerBytes.empty()) return false;
+
+    m_header = reinterpret_cast<const PakHeader*>(headerBytes.data());
+    if (std::memcmp(m_header->magic, k_pakMagic, sizeof(k_pakMagic)) != 0) return false;
+    if (m_header->version != k_pakVersion) return false;
+
+    uint64_t chunkBytes = m_header->chunkCount * sizeof(PakChunk);
+    uint64_t tocBytes = static_cast<uint64_t>(m_header->entryCount) * sizeof(PakEntry);
+    std::span<const uint8_t> chunks = m_file.slice(m_header->chunkTableOffset, chunkBytes);
+    std::span<const uint8_t> toc = m_file.slice(m_header->tocOffset, tocBytes);
+    std::span<const uint8_t> strings = m_file.slice(m_header->stringsOffset, m_header->stringsSize);
+    if ((chunkBytes && chunks.empty()) || (tocBytes && toc.empty()) || (m_header->stringsSize && strings.empty()))
+    {
+        return false;
+    }
+
+    // Таблиці лежать поспіль, тому хешуємо їх одним проходом
+    if (m_header->tocOffset != m_header->chunkTableOffset + chunkBytes ||
+        m_header->stringsOffset != m_header->tocOffset + tocBytes)
+    {
+        return false;
+    }
+    uint64_t tablesSize = chunkBytes + tocBytes + m_header->stringsSize;
+    std::span<const uint8_t> tables = m_file.slice(m_header->chunkTableOffset, tablesSize);
+    if (Hash::xxh64(tables.data(), tables.size()) != m_header->tocHash) return false;
+
+    m_chunks = { reinterpret_cast<const PakChunk*>(chunks.data()), static_cast<size_t>(m_header->chunkCount) };
+    m_entries = { reinterpret_cast<const PakEntry*>(toc.data()), m_header->entryCount };
+    m_strings = { reinterpret_cast<const char*>(strings.data()), strings.size() };
+
+    for (const PakEntry& entry : m_entries)
+    {
+        if (static_cast<uint64_t>(entry.nameOffset) + entry.nameLength > m_strings.size()) return false;
+        if (entry.offset > fileSize || entry.storedSize > fileSize - entry.offset) return false;
+
+        if (entry.compression == PakCompression::LZ4)
+        {
+            if (static_cast<uint64_t>(entry.firstChunk) + entry.chunkCount > m_chunks.size()) return false;
+            if (m_header->chunkSize == 0) return false;
+            if (entry.chunkCount != (entry.size + m_header->chunkSize - 1) / m_header->chunkSize) return false;
+            for (uint32_t i = 0; i < entry.chunkCount; i++)
+            {
+                const PakChunk& chunk = m_chunks[entry.firstChunk + i];
+                uint64_t expected = std::min<uint64_t>(m_header->chunkSize, entry.size - uint64_t(i) * m_header->chunkSize);
+                if (chunk.size != expected) return false;
+                if (chunk.offset > fileSize || chunk.storedSize > fileSize - chunk.offset) return false;
+            }
+        }
+        else if (entry.compression != PakCompression::None || entry.size != entry.storedSize)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::string_view PakArchive::getName(const PakEntry& entry) const
+{
+    return m_strings.substr(entry.nameOffset, entry.nameLength);
+}
+
+const PakEntry* PakArchive::find(std::string_view path) const
+{
+    uint64_t hash = Hash::fnv1a64(path);
+    auto it = std::lower_bound(m_entries.begin(), m_entries.end(), hash,
+        [](const PakEntry& entry, uint64_t value) { return entry.pathHash < value; });
+
+    // При колізії хешів кілька записів стоять поруч
+    for (; it != m_entries.end() && it->pathHash == hash; ++it)
+    {
+        if (getName(*it) == path) return &*it;
+    }
+    return nullptr;
+}
+
+bool PakArchive::contains(std::string_view path) const
+{
+    return find(path) != nullptr;
+}
+
+uint64_t PakArchive::getSize(std::string_view path) const
+{
+    const PakEntry* entry = find(path);
+    return entry ? entry->size : 0;
+}
+
+std::span<const uint8_t> PakArchive::view(std::string_view path) const
+{
+    const PakEntry* entry = find(path);
+    if (!entry || entry->compression != PakCompression::None) return {};
+    return m_file.slice(entry->offset, entry->size);
+}
+
+bool PakArchive::decompress(const PakEntry& entry, uint64_t offset, std::span<uint8_t> out) const
+{
+    const uint64_t chunkSize = m_header->chunkSize;
+    uint64_t end = offset + out.size();
+    uint32_t first = static_cast<uint32_t>(offset / chunkSize);
+    std::vector<uint8_t> scratch;
+
+    for (uint32_t i = first; i < entry.chunkCount && i * chunkSize < end; i++)
+    {
+        const PakChunk& chunk = m_chunks[entry.firstChunk + i];
+        const uint8_t* stored = m_file.data() + chunk.offset;
+        uint64_t chunkStart = i * chunkSize;
+        uint64_t copyFrom = std::max(offset, chunkStart);
+        uint64_t copyTo = std::min(end, chunkStart + chunk.size);
+        uint8_t* target = out.data() + (copyFrom - offset);
+
+        if (chunk.storedSize == chunk.size)
+        {
+            std::memcpy(target, stored + (copyFrom - chunkStart), copyTo - copyFrom);
+            continue;
+        }
+
+        // Повний блок, що лягає у вихідний буфер, розпаковуємо напряму
+        bool whole = copyFrom == chunkStart && copyTo == chunkStart + chunk.size;
+        if (!whole) scratch.resize(chunk.size);
+        uint8_t* destination = whole ? target : scratch.data();
+
+        if (LZ4::decompress(stored, chunk.storedSize, destination, chunk.size) != static_cast<int64_t>(chunk.size))
+        {
+            LOG_ERROR("ERROR::PAK::DECOMPRESS->{}", getName(entry));
+            return false;
+        }
+        if (!whole) std::memcpy(target, scratch.data() + (copyFrom - chunkStart), copyTo - copyFrom);
+    }
+    return true;
+}
+
+uint64_t PakArchive::read(std::string_view path, uint64_t offset, std::span<uint8_t> out) const
+{
+    const PakEntry* entry = find(path);
+    if (!entry || offset >= entry->size) return 0;
+
+    uint64_t length = std::min<uint64_t>(out.size(), entry->size - offset);
+    std::span<uint8_t> target = out.first(static_cast<size_t>(length));
+
+    if (entry->compression == PakCompression::None)
+    {
+        std::memcpy(target.data(), m_file.data() + entry->offset + offset, target.size());
+        return length;
+    }
+    return decompress(*entry, offset, target) ? length : 0;
+}
+
+bool PakArchive::open(std::string_view path, VirtualFile& out) const
+{
+    const PakEntry* entry = find(path);
+    if (!entry) return false;
+
+    if (entry->compression == PakCompression::None)
+    {
+        std::span<const uint8_t> data = m_file.slice(entry->offset, entry->size);
+        if (m_verifyOnOpen && Hash::xxh64(data.data(), data.size()) != entry->contentHash) return false;
+        out.setView(data, shared_from_this());
+        return true;
+    }
+
+    std::vector<uint8_t> data(static_cast<size_t>(entry->size));
+    if (!decompress(*entry, 0, data)) return false;
+    if (m_verifyOnOpen && Hash::xxh64(data.data(), data.size()) != entry->contentHash) return false;
+    out.setOwned(std::move(data));
+    return true;
+}
+
+bool PakArchive::verify(std::string_view path) const
+{
+    const PakEntry* entry = find(path);
+    if (!entry) return false;
+
+    if (entry->compression == PakCompression::None)
+    {
+        return Hash::xxh64(m_file.data() + entry->offset, entry->size) == entry->contentHash;
+    }
+
+    std::vector<uint8_t> data(static_cast<size_t>(entry->size));
+    return decompress(*entry, 0, data) && Hash::xxh64(data.data(), data.size()) == entry->contentHash;
+}
+
+void PakArchive::list(std::vector<std::string>& out) const
+{
+    out.reserve(out.size() + m_entries.size());
+    for (const PakEntry& entry : m_entries)
+    {
+        out.emplace_back(getName(entry));
+    }
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "EverEngineCore/platform/filesystem/VirtualFileSystem.h"
+#include "EverEngineCore/platform/filesystem/pak/PakFormat.h"
+
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+
+/**
+ * @brief Читач архіву .pak.
+ *
+ * Архів відображається у пам'ять цілком. Таблиця вмісту відсортована за
+ * хешем шляху, тому пошук - це бінарний пошук по цілих числах без
+ * звернень до файлової системи. Нестиснені записи віддаються як вигляд
+ * на відображену пам'ять без копіювання; стиснені розпаковуються поблоково.
+ *
+ * @code
+ * auto pak = PakArchive::load("data/base.pak");
+ * VirtualFileSystem::mount("assets", std::make_shared<ArchiveMount>(pak), 10);
+ * @endcode
+ */
+class PakArchive : public Archive, public std::enable_shared_from_this<PakArchive>
+{
+public:
+    /**
+     * @brief Відкриває та перевіряє архів.
+     * @param path Шлях до файлу архіву.
+     * @return Архів або nullptr, якщо файл пошкоджений чи недоступний.
+     */
+    static std::shared_ptr<PakArchive> load(const std::string& path);
+
+    bool contains(std::string_view path) const override;
+    uint64_t getSize(std::string_view path) const override;
+    bool open(std::string_view path, VirtualFile& out) const override;
+    void list(std::vector<std::string>& out) const override;
+
+    /**
+     * @brief Повертає вигляд на нестиснений запис без копіювання.
+     * @return Порожній span, якщо запису немає або він стиснений.
+     */
+    std::span<const uint8_t> view(std::string_view path) const;
+
+    /**
+     * @brief Розпаковує діапазон запису, читаючи лише потрібні блоки.
+     * @param path Шлях запису.
+     * @param offset Зміщення у розпакованих даних.
+     * @param out Буфер призначення (його розмір задає довжину діапазону).
+     * @return Кількість записаних байтів.
+     */
+    uint64_t read(std::string_view path, uint64_t offset, std::span<uint8_t> out) const;
+
+    /**
+     * @brief Перевіряє хеш вмісту запису.
+     */
+    bool verify(std::string_view path) const;
+
+    /**
+     * @brief Вмикає перевірку хешу вмісту під час кожного open().
+     */
+    void setVerifyOnOpen(bool verify) { m_verifyOnOpen = verify; }
+
+    uint32_t getEntryCount() const { return static_cast<uint32_t>(m_entries.size()); }
+    const std::string& getPath() const { return m_path; }
+
+private:
+    PakArchive() = default;
+
+    bool validate();
+    const PakEntry* find(std::string_view path) const;
+    std::string_view getName(const PakEntry& entry) const;
+    bool decompress(const PakEntry& entry, uint64_t offset, std::span<uint8_t> out) const;
+
+    std::string m_path;
+    MappedFile m_file;
+    const PakHeader* m_header = nullptr;
+    std::span<const PakEntry> m_entries;
+    std::span<const PakChunk> m_chunks;
+    std::string_view m_strings;
+    bool m_verifyOnOpen = false;
+};
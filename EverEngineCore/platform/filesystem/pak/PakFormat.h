@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @file PakFormat.h
+ * @brief Дискові структури формату архіву ресурсів .pak
+ *
+ * Розміщення файлу:
+ * @code
+ * [PakHeader]
+ * [дані записів, кожен вирівняний по PakEntry::alignment]
+ * [PakChunk x chunkCount]        - таблиця блоків стиснених записів
+ * [PakEntry x entryCount]        - таблиця вмісту, відсортована за pathHash
+ * [рядки шляхів]                 - нормалізовані шляхи без завершального нуля
+ * @endcode
+ *
+ * Стиснені записи розбиті на блоки фіксованого розміру (chunkSize до стиснення),
+ * кожен блок стискається LZ4 незалежно, тож будь-який діапазон можна
+ * розпакувати без читання попередніх блоків. Блок, який не вдалося стиснути,
+ * зберігається як є (storedSize == size).
+ * Усі числа записуються у little-endian.
+ */
+
+static constexpr char k_pakMagic[4] = { 'E', 'P', 'A', 'K' };
+static constexpr uint32_t k_pakVersion = 1;
+
+enum class PakCompression : uint32_t
+{
+    None = 0,
+    LZ4 = 1
+};
+
+#pragma pack(push, 1)
+
+struct PakHeader
+{
+    char magic[4];
+    uint32_t version;
+    uint32_t entryCount;
+    uint32_t chunkSize;         ///< Розмір блоку до стиснення
+    uint64_t chunkTableOffset;
+    uint64_t chunkCount;
+    uint64_t tocOffset;
+    uint64_t stringsOffset;
+    uint64_t stringsSize;
+    uint64_t tocHash;           ///< XXH64 таблиці блоків, таблиці вмісту та рядків
+};
+
+struct PakEntry
+{
+    uint64_t pathHash;          ///< Hash::fnv1a64 нормалізованого шляху
+    uint64_t contentHash;       ///< Hash::xxh64 розпакованого вмісту
+    uint64_t offset;            ///< Зміщення даних від початку архіву
+    uint64_t size;              ///< Розмір розпакованих даних
+    uint64_t storedSize;        ///< Розмір даних в архіві
+    uint32_t nameOffset;        ///< Зміщення шляху у таблиці рядків
+    uint32_t nameLength;
+    uint32_t firstChunk;        ///< Індекс першого блоку (лише для стиснених)
+    uint32_t chunkCount;
+    PakCompression compression;
+    uint32_t alignment;
+};
+
+struct PakChunk
+{
+    uint64_t offset;            ///< Зміщення стиснених даних від початку архіву
+    uint32_t storedSize;
+    uint32_t size;
+};
+
+#pragma pack(pop)
+
+static_assert(sizeof(PakHeader) == 64, "PakHeader layout changed");
+static_assert(sizeof(PakEntry) == 64, "PakEntry layout changed");
+static_assert(sizeof(PakChunk) == 16, "PakChunk layout changed");
@@ -0,0 +1,198 @@
+#include "EverEngineCore/platform/filesystem/pak/PakWriter.h"
+#include "EverEngineCore/platform/filesystem/pak/PakFormat.h"
+#include "EverEngineCore/platform/filesystem/pak/LZ4.h"
+#include "EverEngineCore/platform/filesystem/VirtualFileSystem.h"
+#include "EverEngineCore/core/Hash.h"
+#include "EverEngineCore/core/Log.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+bool PakWriter::addFile(std::string_view virtualPath, const std::string& osPath)
+{
+    MappedFile file;
+    if (!file.open(osPath))
+    {
+        LOG_ERROR("ERROR::PAK::READ->{}", osPath);
+        return false;
+    }
+    file.advise(MappedFile::Advice::Sequential);
+    addData(virtualPath, { file.bytes().begin(), file.bytes().end() });
+    return true;
+}
+
+void PakWriter::addData(std::string_view virtualPath, std::vector<uint8_t> data)
+{
+    m_files.push_back({ VirtualFileSystem::normalize(virtualPath), std::move(data) });
+}
+
+size_t PakWriter::addDirectory(const std::string& directory, std::string_view prefix)
+{
+    size_t added = 0;
+    std::string base = prefix.empty() ? "" : VirtualFileSystem::normalize(prefix) + "/";
+
+    for (const auto& entry : Directory::walk(directory))
+    {
+        if (addFile(base + entry.path, Path::join(directory, entry.path))) added++;
+    }
+    return added;
+}
+
+static uint64_t align_up(uint64_t value, uint64_t alignment)
+{
+    return alignment > 1 ? (value + alignment - 1) / alignment * alignment : value;
+}
+
+bool PakWriter::write(const std::string& path) const
+{
+    const uint32_t chunkSize = std::max(1024u, m_options.chunkSize);
+
+    std::vector<const PendingFile*> files;
+    files.reserve(m_files.size());
+    for (const auto& file : m_files) files.push_back(&file);
+
+    // Порядок даних збігається з порядком таблиці вмісту
+    std::sort(files.begin(), files.end(), [](const PendingFile* a, const PendingFile* b) {
+        uint64_t ha = Hash::fnv1a64(a->path), hb = Hash::fnv1a64(b->path);
+        return ha != hb ? ha < hb : a->path < b->path;
+    });
+    for (size_t i = 1; i < files.size(); i++)
+    {
+        if (files[i]->path == files[i - 1]->path)
+        {
+            LOG_ERROR("ERROR::PAK::DUPLICATE_PATH->{}", files[i]->path);
+            return false;
+        }
+    }
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out)
+    {
+        LOG_ERROR("ERROR::PAK::CREATE->{}", path);
+        return false;
+    }
+
+    std::vector<PakEntry> entries;
+    std::vector<PakChunk> chunks;
+    std::string strings;
+    uint64_t position = sizeof(PakHeader);
+    std::vector<uint8_t> compressed;
+    const char zeros[4096] = {};
+
+    auto write_bytes = [&](const void* data, uint64_t size) {
+        out.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+        position += size;
+    };
+    auto pad_to = [&](uint64_t alignment) {
+        uint64_t target = align_up(position, alignment);
+        while (position < target) write_bytes(zeros, std::min<uint64_t>(target - position, sizeof(zeros)));
+    };
+
+    PakHeader header{};
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    for (const PendingFile* file : files)
+    {
+        PakEntry entry{};
+        entry.pathHash = Hash::fnv1a64(file->path);
+        entry.contentHash = Hash::xxh64(file->data.data(), file->data.size());
+        entry.size = file->data.size();
+        entry.nameOffset = static_cast<uint32_t>(strings.size());
+        entry.nameLength = static_cast<uint32_t>(file->path.size());
+        strings += file->path;
+
+        // Стискаємо у тимчасовий буфер, щоб вирішити, чи варто зберігати стиснену версію
+        std::vector<PakChunk> entryChunks;
+        compressed.clear();
+        if (m_options.compress && !file->data.empty())
+        {
+            std::vector<uint8_t> block(LZ4::compressBound(chunkSize));
+            for (uint64_t offset = 0; offset < file->data.size(); offset += chunkSize)
+            {
+                uint32_t size = static_cast<uint32_t>(std::min<uint64_t>(chunkSize, file->data.size() - offset));
+                const uint8_t* src = file->data.data() + offset;
+                size_t stored = LZ4::compress(src, size, block.data(), block.size());
+
+                PakChunk chunk{};
+                chunk.offset = compressed.size();
+                chunk.size = size;
+                if (stored == 0 || stored >= size)
+                {
+                    chunk.storedSize = size;
+                    compressed.insert(compressed.end(), src, src + size);
+                }
+                else
+                {
+                    chunk.storedSize = static_cast<uint32_t>(stored);
+                    compressed.insert(compressed.end(), block.begin(), block.begin() + stored);
+                }
+                entryChunks.push_back(chunk);
+            }
+        }
+
+        bool useCompression = !entryChunks.empty() &&
+            static_cast<float>(compressed.size()) < static_cast<float>(file->data.size()) * m_options.minRatio;
+
+        if (useCompression)
+        {
+            pad_to(8);
+            entry.compression = PakCompression::LZ4;
+            entry.alignment = 8;
+            entry.offset = position;
+            entry.storedSize = compressed.size();
+            entry.firstChunk = static_cast<uint32_t>(chunks.size());
+            entry.chunkCount = static_cast<uint32_t>(entryChunks.size());
+            for (PakChunk chunk : entryChunks)
+            {
+                chunk.offset += position;
+                chunks.push_back(chunk);
+            }
+            write_bytes(compressed.data(), compressed.size());
+        }
+        else
+        {
+            pad_to(m_options.alignment);
+            entry.compression = PakCompression::None;
+            entry.alignment = m_options.alignment;
+            entry.offset = position;
+            entry.storedSize = entry.size;
+            write_bytes(file->data.data(), file->data.size());
+        }
+        entries.push_back(entry);
+    }
+
+    pad_to(8);
+    header.chunkTableOffset = position;
+    header.chunkCount = chunks.size();
+    header.tocOffset = header.chunkTableOffset + chunks.size() * sizeof(PakChunk);
+    header.stringsOffset = header.tocOffset + entries.size() * sizeof(PakEntry);
+    header.stringsSize = strings.size();
+
+    std::vector<uint8_t> tables(chunks.size() * sizeof(PakChunk) + entries.size() * sizeof(PakEntry) + strings.size());
+    uint8_t* cursor = tables.data();
+    if (!chunks.empty()) std::memcpy(cursor, chunks.data(), chunks.size() * sizeof(PakChunk));
+    cursor += chunks.size() * sizeof(PakChunk);
+    if (!entries.empty()) std::memcpy(cursor, entries.data(), entries.size() * sizeof(PakEntry));
+    cursor += entries.size() * sizeof(PakEntry);
+    if (!strings.empty()) std::memcpy(cursor, strings.data(), strings.size());
+    write_bytes(tables.data(), tables.size());
+
+    std::memcpy(header.magic, k_pakMagic, sizeof(k_pakMagic));
+    header.version = k_pakVersion;
+    header.entryCount = static_cast<uint32_t>(entries.size());
+    header.chunkSize = chunkSize;
+    header.tocHash = Hash::xxh64(tables.data(), tables.size());
+
+    out.seekp(0);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.close();
+
+    if (!out)
+    {
+        LOG_ERROR("ERROR::PAK::WRITE->{}", path);
+        return false;
+    }
+    LOG_INFO("PAK::WRITTEN->{} ({} entries, {} bytes)", path, entries.size(), position);
+    return true;
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief Збирач архівів .pak.
+ *
+ * Записи додаються з файлів або з пам'яті, після чого write() сортує
+ * таблицю вмісту за хешем шляху, стискає дані блоками LZ4 (якщо це дає
+ * виграш) та записує архів однією послідовною операцією.
+ *
+ * @code
+ * PakWriter writer;
+ * writer.addDirectory("assets");
+ * writer.write("build/base.pak");
+ * @endcode
+ */
+class PakWriter
+{
+public:
+    /**
+     * @brief Параметри збирання.
+     */
+    struct Options
+    {
+        bool compress = true;           ///< Стискати записи LZ4
+        uint32_t chunkSize = 64 * 1024; ///< Розмір блоку стиснення
+        uint32_t alignment = 16;        ///< Вирівнювання даних нестиснених записів
+        float minRatio = 0.9f;          ///< Запис стискається, лише якщо stored/size < minRatio
+    };
+
+    PakWriter() = default;
+    explicit PakWriter(const Options& options) : m_options(options) {}
+
+    /**
+     * @brief Додає файл з диска.
+     * @param virtualPath Шлях усередині архіву.
+     * @param osPath Шлях до файлу на диску.
+     * @return true, якщо файл прочитано.
+     */
+    bool addFile(std::string_view virtualPath, const std::string& osPath);
+
+    /**
+     * @brief Додає запис з пам'яті.
+     */
+    void addData(std::string_view virtualPath, std::vector<uint8_t> data);
+
+    /**
+     * @brief Рекурсивно додає всі файли директорії.
+     * @param directory Директорія на диску.
+     * @param prefix Префікс шляхів усередині архіву.
+     * @return Кількість доданих файлів.
+     */
+    size_t addDirectory(const std::string& directory, std::string_view prefix = "");
+
+    /**
+     * @brief Записує архів на диск.
+     * @param path Шлях до файлу архіву.
+     * @return true, якщо запис успішний.
+     */
+    bool write(const std::string& path) const;
+
+    size_t getEntryCount() const { return m_files.size(); }
+
+private:
+    struct PendingFile
+    {
+        std::string path;
+        std::vector<uint8_t> data;
+    };
+
+    Options m_options;
+    std::vector<PendingFile> m_files;
+};
@@ -0,0 +1,238 @@
+#include "EverEngineCore/rendering/Mesh.h"
+#include "EverEngineCore/rendering/MeshOptimizer.h"
+#include "EverEngineCore/core/Log.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+Mesh::Mesh(const BufferLayout& layout, const std::string& positionAttribute)
+    : m_layout(layout), m_stride(layout.get_stride())
+{
+    for (const auto& element : m_layout.get_elements())
+    {
+        if (element.type != ShaderDataType::Float3) continue;
+        if (positionAttribute == element.name)
+        {
+            m_positionOffset = element.offset;
+            break;
+        }
+        if (m_positionOffset < 0) m_positionOffset = element.offset;
+    }
+
+    if (m_positionOffset < 0) LOG_WARN("WARN::MESH::NO_POSITIONS (bounds and overdraw optimization disabled)");
+}
+
+void Mesh::set_vertices(const void* data, size_t vertexCount)
+{
+    m_vertexCount = vertexCount;
+    m_vertices.resize(vertexCount * m_stride);
+    if (data) std::memcpy(m_vertices.data(), data, m_vertices.size());
+    recalculate_bounds();
+    m_dirty = true;
+}
+
+void Mesh::set_indices(const uint32_t* indices, size_t count)
+{
+    m_indices.assign(indices, indices + count);
+    m_submeshes.clear();
+    add_submesh(0, static_cast<uint32_t>(count));
+    m_implicitSubmesh = true;
+    m_dirty = true;
+}
+
+void Mesh::add_submesh(uint32_t firstIndex, uint32_t indexCount, uint32_t material)
+{
+    if (static_cast<size_t>(firstIndex) + indexCount > m_indices.size() || indexCount % 3 != 0)
+    {
+        LOG_ERROR("ERROR::MESH::INVALID_SUBMESH ({0}+{1} of {2})", firstIndex, indexCount, m_indices.size());
+        return;
+    }
+
+    if (m_implicitSubmesh)
+    {
+        m_submeshes.clear();
+        m_implicitSubmesh = false;
+    }
+
+    for (const Submesh& other : m_submeshes)
+    {
+        if (firstIndex < other.firstIndex + other.indexCount && other.firstIndex < firstIndex + indexCount)
+        {
+            LOG_ERROR("ERROR::MESH::OVERLAPPING_SUBMESH ({0}+{1} and {2}+{3})",
+                firstIndex, indexCount, other.firstIndex, other.indexCount);
+            return;
+        }
+    }
+
+    Submesh submesh;
+    submesh.firstIndex = firstIndex;
+    submesh.indexCount = indexCount;
+    submesh.material = material;
+    submesh.bounds = compute_bounds(m_indices.data() + firstIndex, indexCount);
+    m_submeshes.push_back(submesh);
+}
+
+void Mesh::clear_submeshes()
+{
+    m_submeshes.clear();
+    m_implicitSubmesh = false;
+}
+
+MeshOptimizeStats Mesh::optimize(const MeshOptimizeOptions& options)
+{
+    MeshOptimizeStats stats;
+    stats.verticesBefore = m_vertexCount;
+    stats.verticesAfter = m_vertexCount;
+    if (m_indices.empty() || m_vertexCount == 0) return stats;
+
+    if (std::any_of(m_indices.begin(), m_indices.end(), [&](uint32_t index) { return index >= m_vertexCount; }))
+    {
+        LOG_ERROR("ERROR::MESH::INDEX_OUT_OF_RANGE ({0} vertices)", m_vertexCount);
+        return stats;
+    }
+
+    stats.acmrBefore = MeshOptimizer::compute_acmr(m_indices.data(), m_indices.size());
+    stats.atvrBefore = MeshOptimizer::compute_atvr(m_indices.data(), m_indices.size(), m_vertexCount);
+
+    std::vector<uint32_t> remap;
+    if (options.weld)
+    {
+        // Злиті вершини роблять спільними трикутники, що мали копії вершин
+        size_t unique = MeshOptimizer::generate_weld_remap(remap, m_vertices.data(), m_vertexCount, m_stride);
+        if (unique < m_vertexCount)
+        {
+            MeshOptimizer::remap_indices(m_indices.data(), m_indices.size(), remap);
+            m_vertices = MeshOptimizer::remap_vertices(m_vertices.data(), m_vertexCount, m_stride, remap, unique);
+            m_vertexCount = unique;
+        }
+    }
+
+    for (const Submesh& submesh : m_submeshes)
+    {
+        uint32_t* indices = m_indices.data() + submesh.firstIndex;
+        if (options.vertexCache) MeshOptimizer::optimize_vertex_cache(indices, submesh.indexCount, m_vertexCount);
+        if (options.overdraw && m_positionOffset >= 0)
+        {
+            MeshOptimizer::optimize_overdraw(indices, submesh.indexCount, get_positions(), m_stride, m_vertexCount,
+                options.overdrawThreshold);
+        }
+    }
+
+    if (options.vertexFetch)
+    {
+        // Вершини в порядку використання читаються з пам'яті послідовно; невикористані відкидаються
+        size_t used = MeshOptimizer::generate_fetch_remap(remap, m_indices.data(), m_indices.size(), m_vertexCount);
+        MeshOptimizer::remap_indices(m_indices.data(), m_indices.size(), remap);
+        m_vertices = MeshOptimizer::remap_vertices(m_vertices.data(), m_vertexCount, m_stride, remap, used);
+        m_vertexCount = used;
+    }
+
+    stats.verticesAfter = m_vertexCount;
+    stats.acmrAfter = MeshOptimizer::compute_acmr(m_indices.data(), m_indices.size());
+    stats.atvrAfter = MeshOptimizer::compute_atvr(m_indices.data(), m_indices.size(), m_vertexCount);
+
+    recalculate_bounds();
+    m_dirty = true;
+
+    LOG_INFO("MESH::OPTIMIZED vertices {0}->{1}, ACMR {2:.3f}->{3:.3f}, ATVR {4:.3f}->{5:.3f}",
+        stats.verticesBefore, stats.verticesAfter, stats.acmrBefore, stats.acmrAfter, stats.atvrBefore, stats.atvrAfter);
+    return stats;
+}
+
+void Mesh::upload(BufferUsage usage)
+{
+    if (m_vertexCount == 0)
+    {
+        LOG_ERROR("ERROR::MESH::EMPTY");
+        return;
+    }
+
+    m_vertexArray = VertexArray::create();
+    m_vertexArray->add_vertex_buffer(VertexBuffer::create(m_vertices.data(), static_cast<uint32_t>(m_vertices.size()), usage), m_layout);
+    if (!m_indices.empty()) m_vertexArray->set_index_buffer(IndexBuffer::create(m_indices.data(), m_indices.size(), usage));
+    m_dirty = false;
+}
+
+DrawIndirectCommand Mesh::get_draw_command(size_t submesh) const
+{
+    DrawIndirectCommand command;
+    if (submesh >= m_submeshes.size()) return command;
+
+    command.count = m_submeshes[submesh].indexCount;
+    command.firstIndex = m_submeshes[submesh].firstIndex;
+    return command;
+}
+
+const float* Mesh::get_positions() const
+{
+    if (m_positionOffset < 0 || m_vertices.empty()) return nullptr;
+    return reinterpret_cast<const float*>(m_vertices.data() + m_positionOffset);
+}
+
+MeshBounds Mesh::compute_bounds(const uint32_t* indices, size_t indexCount) const
+{
+    MeshBounds bounds;
+    const float* positions = get_positions();
+    if (!positions) return bounds;
+
+    float lo[3] = { std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max() };
+    float hi[3] = { std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest() };
+
+    // indices == nullptr - усі вершини; індекси поза буфером вершин пропускаються
+    const size_t count = indices ? indexCount : m_vertexCount;
+    auto vertex_of = [&](size_t i) { return indices ? static_cast<size_t>(indices[i]) : i; };
+    auto position_of = [&](size_t vertex)
+    {
+        std::array<float, 3> position;
+        std::memcpy(position.data(), m_vertices.data() + vertex * m_stride + m_positionOffset, sizeof(position));
+        return position;
+    };
+
+    size_t found = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        const size_t vertex = vertex_of(i);
+        if (vertex >= m_vertexCount) continue;
+
+        auto position = position_of(vertex);
+        for (size_t k = 0; k < 3; k++)
+        {
+            lo[k] = std::min(lo[k], position[k]);
+            hi[k] = std::max(hi[k], position[k]);
+        }
+        found++;
+    }
+    if (found == 0) return bounds;
+
+    const float center[3] = { (lo[0] + hi[0]) * 0.5f, (lo[1] + hi[1]) * 0.5f, (lo[2] + hi[2]) * 0.5f };
+    float radiusSquared = 0.0f;
+    for (size_t i = 0; i < count; i++)
+    {
+        const size_t vertex = vertex_of(i);
+        if (vertex >= m_vertexCount) continue;
+
+        auto position = position_of(vertex);
+        const float dx = position[0] - center[0];
+        const float dy = position[1] - center[1];
+        const float dz = position[2] - center[2];
+        radiusSquared = std::max(radiusSquared, dx * dx + dy * dy + dz * dz);
+    }
+
+    bounds.min = glm::vec3(lo[0], lo[1], lo[2]);
+    bounds.max = glm::vec3(hi[0], hi[1], hi[2]);
+    bounds.center = glm::vec3(center[0], center[1], center[2]);
+    bounds.radius = std::sqrt(radiusSquared);
+    return bounds;
+}
+
+void Mesh::recalculate_bounds()
+{
+    m_bounds = compute_bounds(nullptr, 0);
+    for (Submesh& submesh : m_submeshes)
+    {
+        submesh.bounds = compute_bounds(m_indices.data() + submesh.firstIndex, submesh.indexCount);
+    }
+}
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include <glm/glm.hpp>
+
+#include "EverEngineCore/rendering/buffers/VertexArray.h"
+#include "EverEngineCore/rendering/buffers/IndirectBuffer.h"
+
+/**
+ * @brief Осьовий паралелепіпед і описана сфера.
+ */
+struct MeshBounds
+{
+    glm::vec3 min{ 0.0f };
+    glm::vec3 max{ 0.0f };
+    glm::vec3 center{ 0.0f };
+    float radius = 0.0f;
+};
+
+/**
+ * @brief Діапазон буфера індексів з власним матеріалом.
+ */
+struct Submesh
+{
+    uint32_t firstIndex = 0;
+    uint32_t indexCount = 0;
+    uint32_t material = 0;
+    MeshBounds bounds;
+};
+
+struct MeshOptimizeOptions
+{
+    bool weld = true;               ///< Зливати побайтово однакові вершини
+    bool vertexCache = true;        ///< Порядок трикутників для кешу вершин
+    bool overdraw = true;           ///< Порядок кластерів проти перемальовування
+    bool vertexFetch = true;        ///< Порядок вершин за першим використанням
+    float overdrawThreshold = 1.05f;///< Допустиме погіршення ACMR заради overdraw
+};
+
+struct MeshOptimizeStats
+{
+    size_t verticesBefore = 0;
+    size_t verticesAfter = 0;
+    float acmrBefore = 0.0f;        ///< Промахи кешу вершин на трикутник
+    float acmrAfter = 0.0f;
+    float atvrBefore = 0.0f;        ///< Промахи на вершину (1.0 - кожна вершина обробляється раз)
+    float atvrAfter = 0.0f;
+};
+
+/**
+ * @brief Геометрія з даними на CPU, підмешами та межами.
+ *
+ * Вершини зберігаються як байти у розкладці layout, індекси - 32-бітні.
+ * Після optimize() кожен підмеш малюється з кешу вершин майже без промахів,
+ * а upload() створює VertexArray для малювання.
+ *
+ * @code
+ * Mesh mesh({ { ShaderDataType::Float3, "a_Position" }, { ShaderDataType::Float3, "a_Normal" } });
+ * mesh.set_vertices(vertices.data(), vertexCount);
+ * mesh.set_indices(indices.data(), indices.size());
+ * mesh.optimize();
+ * mesh.upload();
+ * @endcode
+ */
+class Mesh
+{
+public:
+    /**
+     * @param positionAttribute Атрибут Float3 з позиціями (для меж і overdraw);
+     * якщо його немає, береться перший атрибут Float3.
+     */
+    explicit Mesh(const BufferLayout& layout, const std::string& positionAttribute = "a_Position");
+
+    void set_vertices(const void* data, size_t vertexCount);
+    /// Замінює індекси; підмеші скидаються до одного на весь буфер.
+    void set_indices(const uint32_t* indices, size_t count);
+    /**
+     * @brief Додає підмеш; перший виклик після set_indices замінює підмеш на весь буфер.
+     *
+     * Діапазони не можуть перетинатися: optimize() перевпорядковує кожен окремо.
+     */
+    void add_submesh(uint32_t firstIndex, uint32_t indexCount, uint32_t material = 0);
+    void clear_submeshes();
+
+    /**
+     * @brief Оптимізує вершини та індекси для GPU.
+     *
+     * Трикутники переставляються лише в межах свого підмеша, тож діапазони
+     * та матеріали зберігаються. Завантажений VertexArray стає застарілим
+     * до наступного upload().
+     */
+    MeshOptimizeStats optimize(const MeshOptimizeOptions& options = {});
+
+    /// Створює (або перестворює) VertexArray з поточних даних.
+    void upload(BufferUsage usage = BufferUsage::Static);
+    /// Команда непрямого малювання підмеша для IndirectBuffer.
+    DrawIndirectCommand get_draw_command(size_t submesh) const;
+
+    const std::shared_ptr<VertexArray>& get_vertex_array() const { return m_vertexArray; }
+    const BufferLayout& get_layout() const { return m_layout; }
+    const std::vector<uint8_t>& get_vertices() const { return m_vertices; }
+    const std::vector<uint32_t>& get_indices() const { return m_indices; }
+    const std::vector<Submesh>& get_submeshes() const { return m_submeshes; }
+    const MeshBounds& get_bounds() const { return m_bounds; }
+
+    size_t get_vertex_count() const { return m_vertexCount; }
+    size_t get_index_count() const { return m_indices.size(); }
+    bool is_uploaded() const { return m_vertexArray && !m_dirty; }
+private:
+    BufferLayout m_layout;
+    uint32_t m_stride = 0;
+    int64_t m_positionOffset = -1;  ///< -1 - позицій немає
+
+    std::vector<uint8_t> m_vertices;
+    size_t m_vertexCount = 0;
+    std::vector<uint32_t> m_indices;
+    std::vector<Submesh> m_submeshes;
+    bool m_implicitSubmesh = false;     ///< Єдиний підмеш створений set_indices
+    MeshBounds m_bounds;
+
+    std::shared_ptr<VertexArray> m_vertexArray;
+    bool m_dirty = true;
+
+    const float* get_positions() const;
+    MeshBounds compute_bounds(const uint32_t* indices, size_t indexCount) const;
+    void recalculate_bounds();
+};
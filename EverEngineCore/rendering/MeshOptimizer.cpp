@@ -0,0 +1,393 @@
+#include "EverEngineCore/rendering/MeshOptimizer.h"
+#include "EverEngineCore/core/Hash.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+    // Параметри оцінки Форсайта; кеш для оцінки більший за реальний, щоб бачити далі
+    constexpr uint32_t k_scoringCacheSize = 32;
+    constexpr float k_cacheDecayPower = 1.5f;
+    constexpr float k_lastTriangleScore = 0.75f;
+    constexpr float k_valenceBoostScale = 2.0f;
+    constexpr float k_valenceBoostPower = 0.5f;
+
+    float vertex_score(int32_t cachePosition, uint32_t remaining)
+    {
+        // Вершина без необроблених трикутників більше не впливає на вибір
+        if (remaining == 0) return -1.0f;
+
+        float score = 0.0f;
+        if (cachePosition >= 0)
+        {
+            // Вершини щойно виданого трикутника отримують фіксовану оцінку,
+            // інакше наступний трикутник надто часто брав би ті самі дві вершини
+            if (cachePosition < 3) score = k_lastTriangleScore;
+            else
+            {
+                const float scale = 1.0f / (k_scoringCacheSize - 3);
+                score = std::pow(1.0f - (cachePosition - 3) * scale, k_cacheDecayPower);
+            }
+        }
+        // Вершини з малою кількістю трикутників варто закривати першими
+        score += k_valenceBoostScale * std::pow(static_cast<float>(remaining), -k_valenceBoostPower);
+        return score;
+    }
+
+    /**
+     * @brief FIFO-кеш вершин через мітки часу: вершина в кеші, якщо після неї
+     * було менше size промахів. Скидання - просто зсув поточної мітки.
+     */
+    struct FifoCache
+    {
+        std::vector<uint32_t> timestamps;
+        uint32_t timestamp;
+        uint32_t size;
+
+        FifoCache(size_t vertexCount, uint32_t cacheSize)
+            : timestamps(vertexCount, 0), timestamp(cacheSize + 1), size(cacheSize) {}
+
+        /// @return true, якщо вершини не було в кеші.
+        bool access(uint32_t vertex)
+        {
+            if (timestamp - timestamps[vertex] <= size) return false;
+            timestamps[vertex] = timestamp++;
+            return true;
+        }
+
+        uint32_t access_triangle(const uint32_t* triangle)
+        {
+            return access(triangle[0]) + access(triangle[1]) + access(triangle[2]);
+        }
+
+        void flush() { timestamp += size + 1; }
+    };
+
+    size_t vertex_count_of(const uint32_t* indices, size_t indexCount)
+    {
+        uint32_t maxIndex = 0;
+        for (size_t i = 0; i < indexCount; i++) maxIndex = std::max(maxIndex, indices[i]);
+        return indexCount ? static_cast<size_t>(maxIndex) + 1 : 0;
+    }
+
+    std::array<float, 3> load_position(const float* positions, size_t stride, uint32_t vertex)
+    {
+        std::array<float, 3> position;
+        std::memcpy(position.data(), reinterpret_cast<const uint8_t*>(positions) + vertex * stride, sizeof(position));
+        return position;
+    }
+}
+
+size_t MeshOptimizer::generate_weld_remap(std::vector<uint32_t>& remap, const void* vertices, size_t vertexCount, size_t stride)
+{
+    remap.assign(vertexCount, k_invalidIndex);
+    if (vertexCount == 0 || stride == 0) return 0;
+
+    // Відкрита адресація за хешем вмісту; збіг хешу перевіряється порівнянням байтів
+    size_t capacity = 1;
+    while (capacity < vertexCount * 2) capacity <<= 1;
+    std::vector<uint32_t> table(capacity, k_invalidIndex);
+
+    const uint8_t* data = static_cast<const uint8_t*>(vertices);
+    size_t unique = 0;
+    for (size_t vertex = 0; vertex < vertexCount; vertex++)
+    {
+        const uint8_t* bytes = data + vertex * stride;
+        size_t slot = Hash::xxh64(bytes, stride) & (capacity - 1);
+
+        while (table[slot] != k_invalidIndex && std::memcmp(data + table[slot] * stride, bytes, stride) != 0)
+        {
+            slot = (slot + 1) & (capacity - 1);
+        }
+
+        if (table[slot] == k_invalidIndex)
+        {
+            table[slot] = static_cast<uint32_t>(vertex);
+            remap[vertex] = static_cast<uint32_t>(unique++);
+        }
+        else
+        {
+            remap[vertex] = remap[table[slot]];
+        }
+    }
+    return unique;
+}
+
+void MeshOptimizer::optimize_vertex_cache(uint32_t* indices, size_t indexCount, size_t vertexCount)
+{
+    const size_t triangleCount = indexCount / 3;
+    if (triangleCount < 2) return;
+
+    // Списки трикутників кожної вершини; перші remaining[v] елементів - ще не видані
+    std::vector<uint32_t> remaining(vertexCount, 0);
+    for (size_t i = 0; i < triangleCount * 3; i++) remaining[indices[i]]++;
+
+    std::vector<uint32_t> offsets(vertexCount + 1, 0);
+    for (size_t vertex = 0; vertex < vertexCount; vertex++) offsets[vertex + 1] = offsets[vertex] + remaining[vertex];
+
+    std::vector<uint32_t> adjacency(triangleCount * 3);
+    std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+    for (size_t triangle = 0; triangle < triangleCount; triangle++)
+    {
+        for (size_t k = 0; k < 3; k++) adjacency[fill[indices[triangle * 3 + k]]++] = static_cast<uint32_t>(triangle);
+    }
+
+    std::vector<int32_t> cachePosition(vertexCount, -1);
+    std::vector<float> vertexScores(vertexCount);
+    for (size_t vertex = 0; vertex < vertexCount; vertex++) vertexScores[vertex] = vertex_score(-1, remaining[vertex]);
+
+    std::vector<float> triangleScores(triangleCount);
+    std::vector<uint8_t> emitted(triangleCount, 0);
+    uint32_t best = 0;
+    for (size_t triangle = 0; triangle < triangleCount; triangle++)
+    {
+        const uint32_t* tri = &indices[triangle * 3];
+        triangleScores[triangle] = vertexScores[tri[0]] + vertexScores[tri[1]] + vertexScores[tri[2]];
+        if (triangleScores[triangle] > triangleScores[best]) best = static_cast<uint32_t>(triangle);
+    }
+
+    std::vector<uint32_t> output;
+    output.reserve(triangleCount * 3);
+
+    std::array<uint32_t, k_scoringCacheSize + 3> cache{};
+    std::array<uint32_t, k_scoringCacheSize + 3> newCache{};
+    size_t cacheCount = 0;
+    size_t cursor = 0;
+
+    for (size_t emittedCount = 0; emittedCount < triangleCount; emittedCount++)
+    {
+        // Глухий кут: жоден трикутник вершин з кешу не лишився - беремо наступний за порядком
+        if (best == k_invalidIndex)
+        {
+            while (emitted[cursor]) cursor++;
+            best = static_cast<uint32_t>(cursor);
+        }
+
+        const uint32_t* tri = &indices[best * 3];
+        output.insert(output.end(), tri, tri + 3);
+        emitted[best] = 1;
+
+        for (size_t k = 0; k < 3; k++)
+        {
+            const uint32_t vertex = tri[k];
+            uint32_t* list = &adjacency[offsets[vertex]];
+            uint32_t* end = list + remaining[vertex];
+            uint32_t* found = std::find(list, end, best);
+            if (found != end)
+            {
+                std::swap(*found, *(end - 1));
+                remaining[vertex]--;
+            }
+        }
+
+        // Вершини трикутника стають на початок кешу, решта зсувається
+        size_t newCount = 0;
+        for (size_t k = 0; k < 3; k++)
+        {
+            if (std::find(newCache.begin(), newCache.begin() + newCount, tri[k]) == newCache.begin() + newCount)
+                newCache[newCount++] = tri[k];
+        }
+        for (size_t i = 0; i < cacheCount; i++)
+        {
+            if (cache[i] != tri[0] && cache[i] != tri[1] && cache[i] != tri[2]) newCache[newCount++] = cache[i];
+        }
+
+        for (size_t i = 0; i < newCount; i++)
+        {
+            cachePosition[newCache[i]] = i < k_scoringCacheSize ? static_cast<int32_t>(i) : -1;
+        }
+
+        // Оновлюються лише вершини кешу (разом з витісненими) та їхні трикутники
+        for (size_t i = 0; i < newCount; i++)
+        {
+            const uint32_t vertex = newCache[i];
+            const float score = vertex_score(cachePosition[vertex], remaining[vertex]);
+            const float delta = score - vertexScores[vertex];
+            vertexScores[vertex] = score;
+
+            for (uint32_t j = 0; j < remaining[vertex]; j++) triangleScores[adjacency[offsets[vertex] + j]] += delta;
+        }
+
+        best = k_invalidIndex;
+        float bestScore = -1.0f;
+        cacheCount = std::min<size_t>(newCount, k_scoringCacheSize);
+        for (size_t i = 0; i < cacheCount; i++)
+        {
+            const uint32_t vertex = newCache[i];
+            cache[i] = vertex;
+            for (uint32_t j = 0; j < remaining[vertex]; j++)
+            {
+                const uint32_t triangle = adjacency[offsets[vertex] + j];
+                if (triangleScores[triangle] > bestScore)
+                {
+                    bestScore = triangleScores[triangle];
+                    best = triangle;
+                }
+            }
+        }
+    }
+
+    std::copy(output.begin(), output.end(), indices);
+}
+
+void MeshOptimizer::optimize_overdraw(uint32_t* indices, size_t indexCount, const float* positions, size_t positionStride,
+    size_t vertexCount, float threshold)
+{
+    const size_t triangleCount = indexCount / 3;
+    if (triangleCount < 2 || !positions) return;
+
+    // Жорсткі межі - трикутники, де всі три вершини промахнулися (кеш фактично скинуто)
+    std::vector<size_t> hardClusters;
+    uint32_t totalMisses = 0;
+    {
+        FifoCache cache(vertexCount, k_cacheSize);
+        for (size_t triangle = 0; triangle < triangleCount; triangle++)
+        {
+            const uint32_t misses = cache.access_triangle(&indices[triangle * 3]);
+            if (misses == 3) hardClusters.push_back(triangle);
+            totalMisses += misses;
+        }
+    }
+    if (hardClusters.empty() || hardClusters.front() != 0) hardClusters.insert(hardClusters.begin(), 0);
+    hardClusters.push_back(triangleCount);
+
+    // М'які межі: кластер закривається, щойно його ACMR не гірший за threshold від ACMR усього діапазону
+    const float limit = threshold * static_cast<float>(totalMisses) / static_cast<float>(triangleCount);
+    std::vector<size_t> clusters;
+    FifoCache cache(vertexCount, k_cacheSize);
+    for (size_t c = 0; c + 1 < hardClusters.size(); c++)
+    {
+        const size_t start = hardClusters[c];
+        const size_t end = hardClusters[c + 1];
+
+        cache.flush();
+        clusters.push_back(start);
+        size_t softStart = start;
+        uint32_t misses = 0;
+        for (size_t triangle = start; triangle < end; triangle++)
+        {
+            misses += cache.access_triangle(&indices[triangle * 3]);
+            if (triangle + 1 < end && static_cast<float>(misses) <= limit * static_cast<float>(triangle + 1 - softStart))
+            {
+                clusters.push_back(triangle + 1);
+                softStart = triangle + 1;
+                misses = 0;
+                cache.flush();
+            }
+        }
+    }
+    clusters.push_back(triangleCount);
+
+    // Центр і нормаль кожного кластера, зважені площею трикутників
+    const size_t clusterCount = clusters.size() - 1;
+    std::vector<std::array<float, 3>> centroids(clusterCount, { 0.0f, 0.0f, 0.0f });
+    std::vector<std::array<float, 3>> normals(clusterCount, { 0.0f, 0.0f, 0.0f });
+    std::array<float, 3> meshCentroid = { 0.0f, 0.0f, 0.0f };
+    float meshArea = 0.0f;
+
+    for (size_t c = 0; c < clusterCount; c++)
+    {
+        float clusterArea = 0.0f;
+        for (size_t triangle = clusters[c]; triangle < clusters[c + 1]; triangle++)
+        {
+            auto p0 = load_position(positions, positionStride, indices[triangle * 3 + 0]);
+            auto p1 = load_position(positions, positionStride, indices[triangle * 3 + 1]);
+            auto p2 = load_position(positions, positionStride, indices[triangle * 3 + 2]);
+
+            const float e1[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+            const float e2[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+            const float normal[3] = { e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0] };
+            const float area = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+
+            for (size_t k = 0; k < 3; k++)
+            {
+                centroids[c][k] += (p0[k] + p1[k] + p2[k]) / 3.0f * area;
+                normals[c][k] += normal[k];
+            }
+            clusterArea += area;
+        }
+
+        for (size_t k = 0; k < 3; k++) meshCentroid[k] += centroids[c][k];
+        meshArea += clusterArea;
+        if (clusterArea > 0.0f)
+        {
+            for (float& value : centroids[c]) value /= clusterArea;
+        }
+    }
+    if (meshArea > 0.0f)
+    {
+        for (float& value : meshCentroid) value /= meshArea;
+    }
+
+    std::vector<float> keys(clusterCount);
+    for (size_t c = 0; c < clusterCount; c++)
+    {
+        const auto& normal = normals[c];
+        const float length = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+        float key = 0.0f;
+        for (size_t k = 0; k < 3; k++) key += (centroids[c][k] - meshCentroid[k]) * normal[k];
+        keys[c] = length > 0.0f ? key / length : 0.0f;
+    }
+
+    std::vector<uint32_t> order(clusterCount);
+    for (size_t c = 0; c < clusterCount; c++) order[c] = static_cast<uint32_t>(c);
+    std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return keys[a] > keys[b]; });
+
+    std::vector<uint32_t> output;
+    output.reserve(triangleCount * 3);
+    for (uint32_t c : order)
+    {
+        output.insert(output.end(), indices + clusters[c] * 3, indices + clusters[c + 1] * 3);
+    }
+    std::copy(output.begin(), output.end(), indices);
+}
+
+size_t MeshOptimizer::generate_fetch_remap(std::vector<uint32_t>& remap, const uint32_t* indices, size_t indexCount, size_t vertexCount)
+{
+    remap.assign(vertexCount, k_invalidIndex);
+
+    size_t next = 0;
+    for (size_t i = 0; i < indexCount; i++)
+    {
+        uint32_t& target = remap[indices[i]];
+        if (target == k_invalidIndex) target = static_cast<uint32_t>(next++);
+    }
+    return next;
+}
+
+void MeshOptimizer::remap_indices(uint32_t* indices, size_t indexCount, const std::vector<uint32_t>& remap)
+{
+    for (size_t i = 0; i < indexCount; i++) indices[i] = remap[indices[i]];
+}
+
+std::vector<uint8_t> MeshOptimizer::remap_vertices(const void* vertices, size_t vertexCount, size_t stride,
+    const std::vector<uint32_t>& remap, size_t uniqueCount)
+{
+    std::vector<uint8_t> result(uniqueCount * stride);
+    const uint8_t* data = static_cast<const uint8_t*>(vertices);
+    for (size_t vertex = 0; vertex < vertexCount; vertex++)
+    {
+        if (remap[vertex] != k_invalidIndex) std::memcpy(&result[remap[vertex] * stride], data + vertex * stride, stride);
+    }
+    return result;
+}
+
+float MeshOptimizer::compute_acmr(const uint32_t* indices, size_t indexCount, uint32_t cacheSize)
+{
+    const size_t triangleCount = indexCount / 3;
+    if (triangleCount == 0) return 0.0f;
+
+    FifoCache cache(vertex_count_of(indices, indexCount), cacheSize);
+    size_t misses = 0;
+    for (size_t triangle = 0; triangle < triangleCount; triangle++) misses += cache.access_triangle(&indices[triangle * 3]);
+    return static_cast<float>(misses) / static_cast<float>(triangleCount);
+}
+
+float MeshOptimizer::compute_atvr(const uint32_t* indices, size_t indexCount, size_t vertexCount, uint32_t cacheSize)
+{
+    if (vertexCount == 0) return 0.0f;
+    return compute_acmr(indices, indexCount, cacheSize) * static_cast<float>(indexCount / 3) / static_cast<float>(vertexCount);
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Алгоритми впорядкування індексів і вершин для швидшого малювання.
+ *
+ * Усі функції працюють з трикутниками (по три індекси) і можуть
+ * застосовуватися до окремих діапазонів буфера індексів (підмешів).
+ * Рекомендований порядок: weld -> vertex cache -> overdraw -> vertex fetch.
+ *
+ * Якість оцінюється симуляцією FIFO-кешу пост-трансформації:
+ * ACMR (промахи на трикутник, ідеал ~0.5 для регулярної сітки) та
+ * ATVR (промахи на вершину, ідеал 1.0 - кожна вершина обробляється раз).
+ */
+class MeshOptimizer
+{
+public:
+    static constexpr uint32_t k_cacheSize = 16;     ///< Розмір FIFO-кешу для оцінки
+    static constexpr uint32_t k_invalidIndex = ~0u;
+
+    /**
+     * @brief Знаходить побайтово однакові вершини.
+     * @param remap Заповнюється новим індексом для кожної вершини.
+     * @return Кількість унікальних вершин.
+     */
+    static size_t generate_weld_remap(std::vector<uint32_t>& remap, const void* vertices, size_t vertexCount, size_t stride);
+
+    /**
+     * @brief Перевпорядковує трикутники для кешу вершин (алгоритм Т. Форсайта).
+     *
+     * Жадібно вибирає трикутник з найбільшою оцінкою: вершини, що нещодавно
+     * потрапили до кешу, і вершини з малою кількістю необроблених
+     * трикутників цінуються вище, тож сусідні трикутники йдуть поспіль.
+     */
+    static void optimize_vertex_cache(uint32_t* indices, size_t indexCount, size_t vertexCount);
+
+    /**
+     * @brief Перевпорядковує кластери трикутників для меншого перемальовування.
+     *
+     * Індекси мають бути вже оптимізовані для кешу. Буфер ділиться на кластери
+     * в точках скидання кешу та там, де ACMR кластера не гірший за threshold
+     * від ACMR усього діапазону; кластери, що дивляться назовні від центру меша,
+     * малюються першими й затуляють решту (підхід Tipsify, Sander et al.).
+     *
+     * @param positions Позиції (3 float) першої вершини; крок - positionStride байт.
+     * @param threshold Допустиме погіршення ACMR (1.05 - на 5%).
+     */
+    static void optimize_overdraw(uint32_t* indices, size_t indexCount, const float* positions, size_t positionStride,
+        size_t vertexCount, float threshold = 1.05f);
+
+    /**
+     * @brief Нумерує вершини в порядку першого використання.
+     * @param remap Новий індекс кожної вершини; k_invalidIndex - вершина не використовується.
+     * @return Кількість використаних вершин.
+     */
+    static size_t generate_fetch_remap(std::vector<uint32_t>& remap, const uint32_t* indices, size_t indexCount, size_t vertexCount);
+
+    /// Замінює кожен індекс на remap[index].
+    static void remap_indices(uint32_t* indices, size_t indexCount, const std::vector<uint32_t>& remap);
+
+    /**
+     * @brief Переставляє вершини за remap; вершини з k_invalidIndex відкидаються.
+     * @param uniqueCount Кількість вершин після перестановки.
+     */
+    static std::vector<uint8_t> remap_vertices(const void* vertices, size_t vertexCount, size_t stride,
+        const std::vector<uint32_t>& remap, size_t uniqueCount);
+
+    /// Середня кількість промахів кешу на трикутник.
+    static float compute_acmr(const uint32_t* indices, size_t indexCount, uint32_t cacheSize = k_cacheSize);
+    /// Середня кількість промахів кешу на вершину.
+    static float compute_atvr(const uint32_t* indices, size_t indexCount, size_t vertexCount, uint32_t cacheSize = k_cacheSize);
+};
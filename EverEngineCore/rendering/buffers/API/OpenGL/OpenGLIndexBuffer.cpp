@@ -1,20 +1,33 @@
 #include "EverEngineCore/rendering/buffers/API/OpenGL/OpenGLIndexBuffer.h"
+#include "EverEngineCore/rendering/renderer/API/OpenGL/OpenGLState.h"
 #include "EverEngineCore/core/Log.h"
 
 OpenGLIndexBuffer::OpenGLIndexBuffer(const unsigned int* indices, size_t count, BufferUsage usage)
     : m_count(count)
 {
+    const size_t size = count * sizeof(unsigned int);
+    if (OpenGLState::hasDirectStateAccess())
+    {
+        glCreateBuffers(1, &m_ebo);
+        LOG_INFO("INDEX::GEN->{0}", m_ebo);
+        // Індекси ніколи не оновлюються, тож статичний буфер отримує незмінне сховище
+        if (usage == BufferUsage::Static) glNamedBufferStorage(m_ebo, size, indices, 0);
+        else glNamedBufferData(m_ebo, size, indices, usage_to_gl(usage));
+        return;
+    }
+
     glGenBuffers(1, &m_ebo);
     LOG_INFO("INDEX::GEN->{0}", m_ebo);
-    bind();
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(unsigned int), indices, usage_to_gl(usage));
-    unbind();
+    // GL_ELEMENT_ARRAY_BUFFER належить поточному VAO, тож дані завантажуються через іншу точку
+    OpenGLState::bindBuffer(GL_COPY_WRITE_BUFFER, m_ebo);
+    glBufferData(GL_COPY_WRITE_BUFFER, size, indices, usage_to_gl(usage));
 }
 
 OpenGLIndexBuffer::~OpenGLIndexBuffer()
 {
     if (m_ebo != 0)
     {
+        OpenGLState::onBufferDeleted(m_ebo);
         glDeleteBuffers(1, &m_ebo);
         m_ebo = 0;
     }
@@ -23,12 +36,12 @@ OpenGLIndexBuffer::~OpenGLIndexBuffer()
 
 void OpenGLIndexBuffer::bind() const
 {
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_ebo);
+    OpenGLState::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_ebo);
 }
 
 void OpenGLIndexBuffer::unbind() const
 {
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    OpenGLState::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 }
 
 GLenum OpenGLIndexBuffer::usage_to_gl(BufferUsage usage)
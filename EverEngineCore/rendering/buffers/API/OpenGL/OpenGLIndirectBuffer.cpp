@@ -0,0 +1,79 @@
+#include "EverEngineCore/rendering/buffers/API/OpenGL/OpenGLIndirectBuffer.h"
+#include "EverEngineCore/rendering/renderer/API/OpenGL/OpenGLState.h"
+#include "EverEngineCore/core/Log.h"
+
+#include <cstring>
+
+OpenGLIndirectBuffer::OpenGLIndirectBuffer(uint32_t maxDraws, size_t drawDataStride)
+    : m_capacity(maxDraws), m_stride(drawDataStride)
+{
+    if (!is_supported())
+    {
+        LOG_ERROR("ERROR::INDIRECT_BUFFER::UNSUPPORTED (requires GL 4.3)");
+        return;
+    }
+
+    m_commands = std::make_unique<OpenGLStreamBuffer>(maxDraws * sizeof(DrawIndirectCommand));
+
+    if (m_stride != 0)
+    {
+        GLint alignment = 0;
+        glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &alignment);
+        if (alignment > 0) m_storageAlignment = static_cast<size_t>(alignment);
+
+        // Частина кратна вирівнюванню, щоб ділянка на її початку завжди вміщалася
+        size_t size = maxDraws * m_stride;
+        size = (size + m_storageAlignment - 1) / m_storageAlignment * m_storageAlignment;
+        m_drawData = std::make_unique<OpenGLStreamBuffer>(size);
+    }
+
+    reset();
+}
+
+void OpenGLIndirectBuffer::reset()
+{
+    m_count = 0;
+    m_flushed = 0;
+    if (!m_commands) return;
+
+    m_commandSpan = m_commands->allocate(m_capacity * sizeof(DrawIndirectCommand), sizeof(uint32_t));
+    if (m_drawData) m_dataSpan = m_drawData->allocate(m_capacity * m_stride, m_storageAlignment);
+}
+
+uint32_t OpenGLIndirectBuffer::add(const DrawIndirectCommand& command, const void* drawData)
+{
+    if (!m_commandSpan || m_count >= m_capacity)
+    {
+        LOG_ERROR("ERROR::INDIRECT_BUFFER::FULL ({0})", m_capacity);
+        return UINT32_MAX;
+    }
+
+    std::memcpy(m_commandSpan.data + m_count * sizeof(DrawIndirectCommand), &command, sizeof(DrawIndirectCommand));
+    if (drawData && m_dataSpan) std::memcpy(m_dataSpan.data + m_count * m_stride, drawData, m_stride);
+    return m_count++;
+}
+
+void OpenGLIndirectBuffer::bind(uint32_t binding)
+{
+    if (!m_commandSpan) return;
+
+    if (m_count > m_flushed)
+    {
+        const size_t first = m_flushed * sizeof(DrawIndirectCommand);
+        m_commands->flush(m_commandSpan, first, (m_count - m_flushed) * sizeof(DrawIndirectCommand));
+        if (m_dataSpan) m_drawData->flush(m_dataSpan, m_flushed * m_stride, (m_count - m_flushed) * m_stride);
+        m_flushed = m_count;
+    }
+
+    OpenGLState::bindBuffer(GL_DRAW_INDIRECT_BUFFER, m_commands->get_id());
+    if (m_dataSpan)
+    {
+        OpenGLState::bindBufferRange(GL_SHADER_STORAGE_BUFFER, binding, m_drawData->get_id(),
+            static_cast<GLintptr>(m_dataSpan.offset), static_cast<GLsizeiptr>(m_dataSpan.size));
+    }
+}
+
+bool OpenGLIndirectBuffer::is_supported()
+{
+    return GLAD_GL_VERSION_4_3 != 0;
+}
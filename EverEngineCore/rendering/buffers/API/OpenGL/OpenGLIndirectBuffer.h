@@ -0,0 +1,40 @@
+#pragma once
+
+#include <memory>
+#include "EverEngineCore/rendering/buffers/IndirectBuffer.h"
+#include "EverEngineCore/rendering/buffers/API/OpenGL/OpenGLStreamBuffer.h"
+#include "glad/glad.h"
+
+/**
+ * @brief Команди та дані команд у двох кільцевих буферах OpenGLStreamBuffer.
+ *
+ * Кожен reset() займає цілу частину кожного кільця, тож набір, поданий у
+ * попередніх кадрах, не перезаписується, доки GPU його не прочитає.
+ */
+class OpenGLIndirectBuffer : public IndirectBuffer
+{
+public:
+    OpenGLIndirectBuffer(uint32_t maxDraws, size_t drawDataStride);
+
+    void reset() override;
+    uint32_t add(const DrawIndirectCommand& command, const void* drawData = nullptr) override;
+    void bind(uint32_t binding = static_cast<uint32_t>(StorageBinding::DrawData)) override;
+
+    uint32_t get_count() const override { return m_count; }
+    uint32_t get_capacity() const override { return m_capacity; }
+    size_t get_draw_data_stride() const override { return m_stride; }
+    size_t get_offset() const override { return m_commandSpan.offset; }
+
+    static bool is_supported();
+private:
+    uint32_t m_capacity = 0;
+    size_t m_stride = 0;
+    size_t m_storageAlignment = 256;
+
+    std::unique_ptr<OpenGLStreamBuffer> m_commands;
+    std::unique_ptr<OpenGLStreamBuffer> m_drawData;
+    StreamSpan m_commandSpan;
+    StreamSpan m_dataSpan;
+    uint32_t m_count = 0;
+    uint32_t m_flushed = 0;     ///< Команди, вже передані в GPU (запасний шлях без відображення)
+};
@@ -0,0 +1,185 @@
+#include "EverEngineCore/rendering/buffers/API/OpenGL/OpenGLStreamBuffer.h"
+#include "EverEngineCore/rendering/renderer/API/OpenGL/OpenGLState.h"
+#include "EverEngineCore/core/Log.h"
+
+namespace
+{
+    constexpr GLbitfield k_persistentFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    constexpr GLuint64 k_fenceTimeout = 1000000000;  ///< 1 с у наносекундах
+
+    void wait_fence(GLsync& fence)
+    {
+        if (!fence) return;
+
+        GLenum result;
+        do
+        {
+            result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, k_fenceTimeout);
+        } while (result == GL_TIMEOUT_EXPIRED);
+
+        if (result == GL_WAIT_FAILED) LOG_ERROR("ERROR::STREAM_BUFFER::FENCE_WAIT_FAILED");
+
+        glDeleteSync(fence);
+        fence = nullptr;
+    }
+
+    size_t align_up(size_t value, size_t alignment)
+    {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+}
+
+OpenGLStreamBuffer::OpenGLStreamBuffer(size_t partitionSize)
+    : m_partitionSize(partitionSize)
+{
+    const size_t capacity = m_partitionSize * k_partitions;
+
+    if (OpenGLState::hasDirectStateAccess())
+    {
+        // Сховище, відображення й оновлення - за ідентифікатором, без прив'язок
+        glCreateBuffers(1, &m_buffer);
+        glNamedBufferStorage(m_buffer, capacity, nullptr, k_persistentFlags);
+        m_mapped = static_cast<uint8_t*>(glMapNamedBufferRange(m_buffer, 0, capacity, k_persistentFlags));
+        if (!m_mapped) LOG_ERROR("ERROR::STREAM_BUFFER::MAP_FAILED");
+        else
+        {
+            LOG_INFO("STREAM_BUFFER::CREATED->{0} ({1} x {2} bytes, persistent)", m_buffer, k_partitions, m_partitionSize);
+            return;
+        }
+
+        OpenGLState::onBufferDeleted(m_buffer);
+        glDeleteBuffers(1, &m_buffer);
+        glCreateBuffers(1, &m_buffer);
+        glNamedBufferData(m_buffer, capacity, nullptr, GL_STREAM_DRAW);
+        m_staging.resize(m_partitionSize);
+        LOG_INFO("STREAM_BUFFER::CREATED->{0} ({1} x {2} bytes, orphaning)", m_buffer, k_partitions, m_partitionSize);
+        return;
+    }
+
+    glGenBuffers(1, &m_buffer);
+    // GL_COPY_WRITE_BUFFER не зачіпає прив'язок VAO
+    OpenGLState::bindBuffer(GL_COPY_WRITE_BUFFER, m_buffer);
+
+    if (is_persistent_supported())
+    {
+        glBufferStorage(GL_COPY_WRITE_BUFFER, capacity, nullptr, k_persistentFlags);
+        m_mapped = static_cast<uint8_t*>(glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, capacity, k_persistentFlags));
+        if (!m_mapped) LOG_ERROR("ERROR::STREAM_BUFFER::MAP_FAILED");
+    }
+
+    if (!m_mapped)
+    {
+        // Сховище glBufferStorage незмінне, тож для запасного шляху потрібен новий буфер
+        if (is_persistent_supported())
+        {
+            OpenGLState::onBufferDeleted(m_buffer);
+            glDeleteBuffers(1, &m_buffer);
+            glGenBuffers(1, &m_buffer);
+            OpenGLState::bindBuffer(GL_COPY_WRITE_BUFFER, m_buffer);
+        }
+        glBufferData(GL_COPY_WRITE_BUFFER, capacity, nullptr, GL_STREAM_DRAW);
+        m_staging.resize(m_partitionSize);
+    }
+
+    LOG_INFO("STREAM_BUFFER::CREATED->{0} ({1} x {2} bytes, {3})", m_buffer, k_partitions, m_partitionSize,
+        m_mapped ? "persistent" : "orphaning");
+}
+
+OpenGLStreamBuffer::~OpenGLStreamBuffer()
+{
+    for (GLsync& fence : m_fences)
+    {
+        if (fence) glDeleteSync(fence);
+        fence = nullptr;
+    }
+
+    if (m_buffer != 0)
+    {
+        if (m_mapped && OpenGLState::hasDirectStateAccess())
+        {
+            glUnmapNamedBuffer(m_buffer);
+        }
+        else if (m_mapped)
+        {
+            OpenGLState::bindBuffer(GL_COPY_WRITE_BUFFER, m_buffer);
+            glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+        }
+        OpenGLState::onBufferDeleted(m_buffer);
+        glDeleteBuffers(1, &m_buffer);
+        m_buffer = 0;
+    }
+}
+
+StreamSpan OpenGLStreamBuffer::allocate(size_t size, size_t alignment)
+{
+    if (size == 0 || size > m_partitionSize)
+    {
+        LOG_ERROR("ERROR::STREAM_BUFFER::INVALID_SIZE ({0} of {1})", size, m_partitionSize);
+        return {};
+    }
+    if (alignment == 0) alignment = 1;
+
+    size_t base = m_partition * m_partitionSize;
+    size_t offset = align_up(base + m_head, alignment);
+    if (offset + size > base + m_partitionSize)
+    {
+        next_partition();
+        base = m_partition * m_partitionSize;
+        offset = align_up(base, alignment);
+        if (offset + size > base + m_partitionSize)
+        {
+            LOG_ERROR("ERROR::STREAM_BUFFER::ALIGNMENT ({0})", alignment);
+            return {};
+        }
+    }
+    m_head = offset + size - base;
+
+    uint8_t* memory = m_mapped ? m_mapped + offset : m_staging.data() + (offset - base);
+    return { memory, offset, size };
+}
+
+void OpenGLStreamBuffer::flush(const StreamSpan& span, size_t offset, size_t size)
+{
+    if (m_mapped || !span || size == 0) return;
+
+    if (OpenGLState::hasDirectStateAccess())
+    {
+        glNamedBufferSubData(m_buffer, span.offset + offset, size, span.data + offset);
+        return;
+    }
+    OpenGLState::bindBuffer(GL_COPY_WRITE_BUFFER, m_buffer);
+    glBufferSubData(GL_COPY_WRITE_BUFFER, span.offset + offset, size, span.data + offset);
+}
+
+void OpenGLStreamBuffer::begin_frame()
+{
+    if (m_head > 0) next_partition();
+}
+
+bool OpenGLStreamBuffer::is_persistent_supported()
+{
+    return GLAD_GL_VERSION_4_4 != 0;
+}
+
+void OpenGLStreamBuffer::next_partition()
+{
+    // Паркан ставиться після всіх викликів малювання, що читають цю частину
+    if (m_mapped) m_fences[m_partition] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+    m_partition = (m_partition + 1) % k_partitions;
+    m_head = 0;
+
+    if (m_mapped)
+    {
+        wait_fence(m_fences[m_partition]);
+    }
+    else if (m_partition == 0 && OpenGLState::hasDirectStateAccess())
+    {
+        glNamedBufferData(m_buffer, m_partitionSize * k_partitions, nullptr, GL_STREAM_DRAW);
+    }
+    else if (m_partition == 0)
+    {
+        OpenGLState::bindBuffer(GL_COPY_WRITE_BUFFER, m_buffer);
+        glBufferData(GL_COPY_WRITE_BUFFER, m_partitionSize * k_partitions, nullptr, GL_STREAM_DRAW);
+    }
+}
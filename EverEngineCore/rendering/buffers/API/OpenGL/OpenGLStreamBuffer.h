@@ -0,0 +1,92 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <glad/glad.h>
+
+/**
+ * @brief Ділянка потокового буфера, видана для запису з CPU.
+ */
+struct StreamSpan
+{
+    uint8_t* data = nullptr;    ///< Пам'ять для запису (nullptr - ділянку не виділено)
+    size_t offset = 0;          ///< Зміщення ділянки в буфері GL
+    size_t size = 0;
+
+    explicit operator bool() const { return data != nullptr; }
+};
+
+/**
+ * @brief Кільцевий буфер для даних, що оновлюються щокадру.
+ *
+ * Буфер поділено на k_partitions частин. Ділянки виділяються послідовно в
+ * поточній частині; коли вона заповнена (або на початку кадру, див.
+ * begin_frame()), на неї ставиться glFenceSync і запис переходить до
+ * наступної частини, попередньо дочекавшись її паркану. Так CPU пише в одну
+ * частину, поки GPU читає інші, і жоден виклик не змушує драйвер
+ * синхронізуватися неявно. Щоб очікування паркану не припадало на середину
+ * кадру, частина має вміщати всі дані кадру.
+ *
+ * На GL 4.4+ сховище створюється через glBufferStorage і постійно
+ * відображене (GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT): ділянки
+ * вказують прямо в пам'ять буфера. На старіших версіях ділянки пишуться у
+ * проміжний масив і заливаються в flush() через glBufferSubData, а при
+ * поверненні на початок кільця буфер "осиротлюється" через glBufferData.
+ * З прямим доступом до стану (GL 4.5) усе це робиться без прив'язок.
+ */
+class OpenGLStreamBuffer
+{
+public:
+    static constexpr uint32_t k_partitions = 3;
+
+    /**
+     * @param partitionSize Розмір однієї частини - найбільша ділянка, яку можна виділити.
+     */
+    explicit OpenGLStreamBuffer(size_t partitionSize);
+    ~OpenGLStreamBuffer();
+
+    OpenGLStreamBuffer(const OpenGLStreamBuffer&) = delete;
+    OpenGLStreamBuffer& operator=(const OpenGLStreamBuffer&) = delete;
+
+    /**
+     * @brief Виділяє ділянку для запису.
+     * @param alignment Зміщення ділянки в буфері буде кратним цьому значенню.
+     * @return Порожня ділянка, якщо size більший за частину.
+     */
+    StreamSpan allocate(size_t size, size_t alignment = 1);
+
+    /**
+     * @brief Робить записані байти ділянки видимими для GPU.
+     *
+     * Для постійно відображеного буфера нічого не робить (пам'ять когерентна).
+     */
+    void flush(const StreamSpan& span, size_t offset, size_t size);
+
+    /**
+     * @brief Переходить до наступної частини на початку кадру.
+     *
+     * Тоді кожна частина містить рівно один кадр і паркан чекає на кадр,
+     * надісланий k_partitions кадрів тому. Якщо з попереднього переходу
+     * нічого не виділялось, нічого не робить.
+     */
+    void begin_frame();
+
+    GLuint get_id() const { return m_buffer; }
+    size_t get_partition_size() const { return m_partitionSize; }
+    bool is_persistent() const { return m_mapped != nullptr; }
+
+    /// Чи підтримує контекст постійно відображені буфери (glBufferStorage).
+    static bool is_persistent_supported();
+private:
+    void next_partition();
+
+    GLuint m_buffer = 0;
+    size_t m_partitionSize = 0;
+    uint8_t* m_mapped = nullptr;
+    std::vector<uint8_t> m_staging;     ///< Лише без постійного відображення
+    std::array<GLsync, k_partitions> m_fences{};
+    uint32_t m_partition = 0;
+    size_t m_head = 0;                  ///< Зайняті байти поточної частини
+};
@@ -0,0 +1,98 @@
+#include "EverEngineCore/rendering/buffers/API/OpenGL/OpenGLUniformBuffer.h"
+#include "EverEngineCore/rendering/renderer/API/OpenGL/OpenGLState.h"
+#include "EverEngineCore/core/Log.h"
+
+#include <cstring>
+
+OpenGLUniformBuffer::OpenGLUniformBuffer(size_t size, BufferUsage usage)
+    : m_size(size)
+{
+    if (usage == BufferUsage::Stream)
+    {
+        GLint alignment = 0;
+        glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+        if (alignment > 0) m_alignment = static_cast<size_t>(alignment);
+
+        m_stream = std::make_unique<OpenGLStreamBuffer>(size);
+        m_ubo = m_stream->get_id();
+        return;
+    }
+
+    if (OpenGLState::hasDirectStateAccess())
+    {
+        glCreateBuffers(1, &m_ubo);
+        LOG_INFO("UNIFORM::GEN->{0}", m_ubo);
+        glNamedBufferStorage(m_ubo, size, nullptr, GL_DYNAMIC_STORAGE_BIT);
+        return;
+    }
+
+    glGenBuffers(1, &m_ubo);
+    LOG_INFO("UNIFORM::GEN->{0}", m_ubo);
+    OpenGLState::bindBuffer(GL_UNIFORM_BUFFER, m_ubo);
+    glBufferData(GL_UNIFORM_BUFFER, size, nullptr, usage == BufferUsage::Static ? GL_STATIC_DRAW : GL_DYNAMIC_DRAW);
+}
+
+OpenGLUniformBuffer::~OpenGLUniformBuffer()
+{
+    if (m_stream)
+    {
+        m_stream.reset();
+    }
+    else if (m_ubo != 0)
+    {
+        OpenGLState::onBufferDeleted(m_ubo);
+        glDeleteBuffers(1, &m_ubo);
+    }
+    LOG_INFO("UNIFORM::DELETE->{0}", m_ubo);
+    m_ubo = 0;
+}
+
+void OpenGLUniformBuffer::set_data(const void* data, size_t size, size_t offset)
+{
+    if (m_stream)
+    {
+        LOG_ERROR("ERROR::UNIFORM::SET_DATA_ON_STREAM (use allocate)");
+        return;
+    }
+    if (offset + size > m_size)
+    {
+        LOG_ERROR("ERROR::UNIFORM::OVERFLOW ({0} of {1})", offset + size, m_size);
+        return;
+    }
+
+    if (OpenGLState::hasDirectStateAccess())
+    {
+        glNamedBufferSubData(m_ubo, offset, size, data);
+        return;
+    }
+    OpenGLState::bindBuffer(GL_UNIFORM_BUFFER, m_ubo);
+    glBufferSubData(GL_UNIFORM_BUFFER, offset, size, data);
+}
+
+UniformAllocation OpenGLUniformBuffer::allocate(const void* data, size_t size)
+{
+    if (!m_stream)
+    {
+        LOG_ERROR("ERROR::UNIFORM::ALLOCATE_ON_STATIC");
+        return {};
+    }
+
+    StreamSpan span = m_stream->allocate(size, m_alignment);
+    if (!span) return {};
+
+    std::memcpy(span.data, data, size);
+    m_stream->flush(span, 0, size);
+    return { span.offset, size };
+}
+
+void OpenGLUniformBuffer::bind(uint32_t binding) const
+{
+    OpenGLState::bindBufferRange(GL_UNIFORM_BUFFER, binding, m_ubo, 0, static_cast<GLsizeiptr>(m_size));
+}
+
+void OpenGLUniformBuffer::bind_range(uint32_t binding, const UniformAllocation& allocation) const
+{
+    if (!allocation) return;
+    OpenGLState::bindBufferRange(GL_UNIFORM_BUFFER, binding, m_ubo,
+        static_cast<GLintptr>(allocation.offset), static_cast<GLsizeiptr>(allocation.size));
+}
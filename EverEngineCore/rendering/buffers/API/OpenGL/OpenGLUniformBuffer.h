@@ -0,0 +1,28 @@
+#pragma once
+
+#include <memory>
+#include "EverEngineCore/rendering/buffers/UniformBuffer.h"
+#include "EverEngineCore/rendering/buffers/API/OpenGL/OpenGLStreamBuffer.h"
+#include "glad/glad.h"
+
+class OpenGLUniformBuffer : public UniformBuffer
+{
+public:
+    OpenGLUniformBuffer(size_t size, BufferUsage usage);
+    virtual ~OpenGLUniformBuffer();
+
+    void set_data(const void* data, size_t size, size_t offset = 0) override;
+    UniformAllocation allocate(const void* data, size_t size) override;
+
+    void bind(uint32_t binding) const override;
+    void bind_range(uint32_t binding, const UniformAllocation& allocation) const override;
+
+    size_t get_size() const override { return m_size; }
+    GLuint get_id() const { return m_ubo; }
+private:
+    GLuint m_ubo = 0;
+    size_t m_size = 0;
+    size_t m_alignment = 256;
+
+    std::unique_ptr<OpenGLStreamBuffer> m_stream;
+};
@@ -1,11 +1,13 @@
 #include "EverEngineCore/rendering/buffers/API/OpenGL/OpenGLIndexBuffer.h"
 #include "EverEngineCore/rendering/buffers/API/OpenGL/OpenGLVertexBuffer.h"
 #include "EverEngineCore/rendering/buffers/API/OpenGL/OpenGLVertexArray.h"
+#include "EverEngineCore/rendering/renderer/API/OpenGL/OpenGLState.h"
 #include "EverEngineCore/core/Log.h"
 
 OpenGLVertexArray::OpenGLVertexArray()
 {
-    glGenVertexArrays(1, &m_vao);
+    if (OpenGLState::hasDirectStateAccess()) glCreateVertexArrays(1, &m_vao);
+    else glGenVertexArrays(1, &m_vao);
     LOG_INFO("VAO::CREATED->{0}", m_vao);
 }
 
@@ -13,6 +15,7 @@ OpenGLVertexArray::~OpenGLVertexArray()
 {
     if (m_vao != 0)
     {
+        OpenGLState::onVertexArrayDeleted(m_vao);
         glDeleteVertexArrays(1, &m_vao);
         m_vao = 0;
     }
@@ -21,38 +24,58 @@ OpenGLVertexArray::~OpenGLVertexArray()
 
 void OpenGLVertexArray::bind() const
 {
-    glBindVertexArray(m_vao);
+    OpenGLState::bindVertexArray(m_vao);
 }
 
 void OpenGLVertexArray::unbind() const
 {
-    glBindVertexArray(0);
+    OpenGLState::bindVertexArray(0);
 }
 
 void OpenGLVertexArray::draw(DrawMode mode) const
 {
     bind();
 
-    GLenum glMode = GL_TRIANGLES;
-    switch(mode)
+    GLenum glMode = draw_mode_to_gl(mode);
+
+    if(m_indexBuffer)
     {
-    case DrawMode::Triangles:     glMode = GL_TRIANGLES; break;
-    case DrawMode::Lines:         glMode = GL_LINES; break;
-    case DrawMode::Points:        glMode = GL_POINTS; break;
-    case DrawMode::TriangleStrip: glMode = GL_TRIANGLE_STRIP; break;
-    case DrawMode::LineStrip:     glMode = GL_LINE_STRIP; break;
-    case DrawMode::Patches:       glMode = GL_PATCHES; break;
+        glDrawElementsBaseVertex(glMode, m_indexBuffer->get_count(), GL_UNSIGNED_INT, nullptr, get_base_vertex());
     }
+    else
+    {
+        glDrawArrays(glMode, get_base_vertex(), get_vertex_count());
+    }
+}
+
+void OpenGLVertexArray::draw_instanced(DrawMode mode, uint32_t instanceCount) const
+{
+    bind();
+
+    GLenum glMode = draw_mode_to_gl(mode);
 
     if(m_indexBuffer)
     {
-        glDrawElements(glMode, m_indexBuffer->get_count(), GL_UNSIGNED_INT, nullptr);
+        glDrawElementsInstancedBaseVertex(glMode, m_indexBuffer->get_count(), GL_UNSIGNED_INT, nullptr,
+            instanceCount, get_base_vertex());
     }
     else
     {
-        glDrawArrays(glMode, 0, m_vertexCount);
+        glDrawArraysInstanced(glMode, get_base_vertex(), get_vertex_count(), instanceCount);
     }
-    unbind();
+}
+
+size_t OpenGLVertexArray::get_vertex_count() const
+{
+    // Розмір потокового буфера змінюється з кожним set_data
+    if (m_streamBuffer) return m_streamBuffer->get_size() / m_streamStride;
+    return m_vertexCount;
+}
+
+int32_t OpenGLVertexArray::get_base_vertex() const
+{
+    if (!m_streamBuffer) return 0;
+    return static_cast<int32_t>(m_streamBuffer->get_offset() / m_streamStride);
 }
 
 void OpenGLVertexArray::add_vertex_buffer(const std::shared_ptr<VertexBuffer>& vbo, const BufferLayout& layout)
@@ -63,38 +86,122 @@ void OpenGLVertexArray::add_vertex_buffer(const std::shared_ptr<VertexBuffer>& v
         return;
     }
 
-    bind();
-    vbo->bind();
+    // Потоковий буфер вирівнюється до прив'язки, бо при цьому змінюється його ідентифікатор.
+    // Зміщення даних у ньому передається як base vertex, тому підтримується лише буфер вершин
+    auto* glVbo = dynamic_cast<OpenGLVertexBuffer*>(vbo.get());
+    if (glVbo && glVbo->is_streaming())
+    {
+        if (layout.is_instanced() || m_streamBuffer)
+        {
+            LOG_ERROR("ERROR::VBO::UNSUPPORTED_STREAM_LAYOUT");
+            return;
+        }
+        glVbo->set_stride(layout.get_stride());
+        m_streamBuffer = glVbo;
+        m_streamStride = layout.get_stride();
+    }
+
+    // З прямим доступом до стану кожен буфер має власну точку прив'язки VAO,
+    // а формат атрибутів задається окремо від неї - без прив'язки VAO і VBO
+    const bool dsa = OpenGLState::hasDirectStateAccess();
+    const GLuint bindingIndex = static_cast<GLuint>(m_vertexBuffers.size());
+    if (dsa)
+    {
+        if (!glVbo)
+        {
+            LOG_ERROR("ERROR::VBO::NOT_OPENGL");
+            return;
+        }
+        glVertexArrayVertexBuffer(m_vao, bindingIndex, glVbo->get_id(), 0, static_cast<GLsizei>(layout.get_stride()));
+        glVertexArrayBindingDivisor(m_vao, bindingIndex, layout.get_instance_divisor());
+    }
+    else
+    {
+        bind();
+        vbo->bind();
+    }
 
     for (const auto& element : layout.get_elements())
     {
-        glEnableVertexAttribArray(m_vertexBufferIndex);
-        glVertexAttribPointer(
-            m_vertexBufferIndex,
-            element.get_components_count(),
-            shader_type_to_gl(element.type),
-            element.normalized ? GL_TRUE : GL_FALSE,
-            layout.get_stride(),
-            (const void*)(intptr_t)element.offset
-        );
-        m_vertexBufferIndex++;
+        GLint components = static_cast<GLint>(element.get_components_count());
+        GLenum type = shader_type_to_gl(element.type);
+
+        // Матриця займає по слоту на стовпець, стовпці йдуть один за одним
+        for (uint32_t column = 0; column < element.get_attribute_slots(); column++)
+        {
+            const GLuint relativeOffset = static_cast<GLuint>(element.offset + column * components * sizeof(float));
+
+            if (dsa)
+            {
+                glEnableVertexArrayAttrib(m_vao, m_vertexBufferIndex);
+                if (is_integer_type(element.type))
+                {
+                    glVertexArrayAttribIFormat(m_vao, m_vertexBufferIndex, components, type, relativeOffset);
+                }
+                else
+                {
+                    glVertexArrayAttribFormat(m_vao, m_vertexBufferIndex, components, type,
+                        element.normalized ? GL_TRUE : GL_FALSE, relativeOffset);
+                }
+                glVertexArrayAttribBinding(m_vao, m_vertexBufferIndex, bindingIndex);
+                m_vertexBufferIndex++;
+                continue;
+            }
+
+            const void* offset = (const void*)(intptr_t)relativeOffset;
+            glEnableVertexAttribArray(m_vertexBufferIndex);
+            if (is_integer_type(element.type))
+            {
+                glVertexAttribIPointer(m_vertexBufferIndex, components, type, layout.get_stride(), offset);
+            }
+            else
+            {
+                glVertexAttribPointer(m_vertexBufferIndex, components, type,
+                    element.normalized ? GL_TRUE : GL_FALSE, layout.get_stride(), offset);
+            }
+            glVertexAttribDivisor(m_vertexBufferIndex, layout.get_instance_divisor());
+            m_vertexBufferIndex++;
+        }
     }
 
     m_vertexBuffers.push_back(vbo);
     LOG_INFO("VBO::ADDED");
-    m_vertexCount = vbo->get_size() / layout.get_stride();
-    unbind();
+    // Буфери екземплярів не визначають кількість вершин
+    if (!layout.is_instanced()) m_vertexCount = vbo->get_size() / layout.get_stride();
 }
 
 void OpenGLVertexArray::set_index_buffer(const std::shared_ptr<IndexBuffer>& ebo)
 {
-    bind();
-    ebo->bind();
+    auto* glEbo = dynamic_cast<const OpenGLIndexBuffer*>(ebo.get());
+    if (OpenGLState::hasDirectStateAccess() && glEbo)
+    {
+        glVertexArrayElementBuffer(m_vao, glEbo->get_id());
+        // Тіньова прив'язка GL_ELEMENT_ARRAY_BUFFER має відповідати VAO, якщо він поточний
+        if (OpenGLState::getVertexArray() == m_vao) ebo->bind();
+    }
+    else
+    {
+        bind();
+        ebo->bind();
+    }
     m_indexBuffer = ebo;
-    unbind();
     LOG_INFO("EBO::SET::SUCCESSFUL");
 }
 
+GLenum OpenGLVertexArray::draw_mode_to_gl(DrawMode mode)
+{
+    switch(mode)
+    {
+    case DrawMode::Triangles:     return GL_TRIANGLES;
+    case DrawMode::Lines:         return GL_LINES;
+    case DrawMode::Points:        return GL_POINTS;
+    case DrawMode::TriangleStrip: return GL_TRIANGLE_STRIP;
+    case DrawMode::LineStrip:     return GL_LINE_STRIP;
+    case DrawMode::Patches:       return GL_PATCHES;
+    }
+    return GL_TRIANGLES;
+}
+
 GLenum OpenGLVertexArray::shader_type_to_gl(ShaderDataType type)
 {
     switch (type)
@@ -114,7 +221,7 @@ GLenum OpenGLVertexArray::shader_type_to_gl(ShaderDataType type)
         return GL_INT;
         
     case ShaderDataType::Bool:
-        return GL_BOOL;
+        return GL_UNSIGNED_BYTE;
         
     case ShaderDataType::None:
         return 0;
@@ -122,5 +229,17 @@ GLenum OpenGLVertexArray::shader_type_to_gl(ShaderDataType type)
     return 0;
 }
 
-
-
+bool OpenGLVertexArray::is_integer_type(ShaderDataType type)
+{
+    switch (type)
+    {
+    case ShaderDataType::Int:
+    case ShaderDataType::Int2:
+    case ShaderDataType::Int3:
+    case ShaderDataType::Int4:
+    case ShaderDataType::Bool:
+        return true;
+    default:
+        return false;
+    }
+}
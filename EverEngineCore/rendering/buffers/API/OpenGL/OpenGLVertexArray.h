@@ -3,6 +3,8 @@
 #include "EverEngineCore/rendering/buffers/VertexArray.h"
 #include <glad/glad.h>
 
+class OpenGLVertexBuffer;
+
 class OpenGLVertexArray : public VertexArray
 {
 public:
@@ -12,6 +14,7 @@ public:
     void bind() const override;
     void unbind() const override;
     void draw(DrawMode mode = DrawMode::Triangles) const override;
+    void draw_instanced(DrawMode mode, uint32_t instanceCount) const override;
 
     void add_vertex_buffer(const std::shared_ptr<VertexBuffer>& vbo, const BufferLayout& layout) override;
     void set_index_buffer(const std::shared_ptr<IndexBuffer>& ebo) override;
@@ -19,12 +22,19 @@ public:
     const std::vector<std::shared_ptr<VertexBuffer>>& get_vertex_buffers() const override { return m_vertexBuffers; }
     const std::shared_ptr<IndexBuffer>& get_index_buffer() const override { return m_indexBuffer; }
 
-    GLuint get_id() const { return m_vao; }
+    size_t get_vertex_count() const override;
+    int32_t get_base_vertex() const override;
+    uint32_t get_id() const override { return m_vao; }
+
+    static GLenum draw_mode_to_gl(DrawMode mode);
 private:
     GLuint m_vao = 0;
     std::vector<std::shared_ptr<VertexBuffer>> m_vertexBuffers;
     std::shared_ptr<IndexBuffer> m_indexBuffer;
     GLuint m_vertexBufferIndex = 0;
     size_t m_vertexCount = 0;
+    const OpenGLVertexBuffer* m_streamBuffer = nullptr;   ///< Потоковий буфер вершин, якщо є
+    uint32_t m_streamStride = 0;
     GLenum shader_type_to_gl(ShaderDataType type);
+    static bool is_integer_type(ShaderDataType type);
 };
\ No newline at end of file
@@ -1,29 +1,48 @@
 #include "EverEngineCore/rendering/buffers/API/OpenGL/OpenGLVertexBuffer.h"
+#include "EverEngineCore/rendering/renderer/API/OpenGL/OpenGLState.h"
 #include "EverEngineCore/core/Log.h"
 
+#include <cstring>
+
 OpenGLVertexBuffer::OpenGLVertexBuffer(const void* data, size_t size, BufferUsage usage)
     : m_size(size),  m_usage(usage)
 {
-    glGenBuffers(1, &m_vbo);
-    bind();
-    glBufferData(GL_ARRAY_BUFFER, size, data, usage_to_gl(usage));
-    unbind();
+    if (usage == BufferUsage::Stream)
+    {
+        m_stream = std::make_unique<OpenGLStreamBuffer>(size);
+        m_vbo = m_stream->get_id();
+        if (data) set_data(data, size);
+        return;
+    }
+
+    create_buffer(data, size);
 }
 
 OpenGLVertexBuffer::OpenGLVertexBuffer(size_t size, BufferUsage usage)
     : m_size(size), m_usage(usage)
 {
-    glGenBuffers(1, &m_vbo);
+    if (usage == BufferUsage::Stream)
+    {
+        m_stream = std::make_unique<OpenGLStreamBuffer>(size);
+        m_vbo = m_stream->get_id();
+        return;
+    }
+
+    create_buffer(nullptr, size);
     LOG_INFO("VERTEX::GEN->{0}", m_vbo);
-    bind();
-    glBufferData(GL_ARRAY_BUFFER, size, nullptr, usage_to_gl(usage));
-    unbind();
 }
 
 OpenGLVertexBuffer::~OpenGLVertexBuffer()
 {
-    if (m_vbo != 0)
+    if (m_stream)
     {
+        // Буфер належить кільцю
+        m_stream.reset();
+        m_vbo = 0;
+    }
+    else if (m_vbo != 0)
+    {
+        OpenGLState::onBufferDeleted(m_vbo);
         glDeleteBuffers(1, &m_vbo);
         m_vbo = 0;
     }
@@ -32,27 +51,113 @@ OpenGLVertexBuffer::~OpenGLVertexBuffer()
 
 void OpenGLVertexBuffer::bind() const
 {
-    glBindBuffer(GL_ARRAY_BUFFER, m_vbo);
+    OpenGLState::bindBuffer(GL_ARRAY_BUFFER, m_vbo);
 }
 
 void OpenGLVertexBuffer::unbind() const
 {
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    OpenGLState::bindBuffer(GL_ARRAY_BUFFER, 0);
 }
 
 void OpenGLVertexBuffer::set_data(const void* data, size_t size)
 {
+    if (m_stream)
+    {
+        // Нова ділянка кільця замість перевиділення: GPU може ще читати попередню
+        StreamSpan span = m_stream->allocate(size, m_stride);
+        if (!span) return;
+        m_span = span;
+        m_size = size;
+        if (data) update_data(0, data, size);
+        return;
+    }
+
     m_size = size;
+    if (OpenGLState::hasDirectStateAccess())
+    {
+        glNamedBufferData(m_vbo, size, data, usage_to_gl(m_usage));
+        return;
+    }
     bind();
     glBufferData(GL_ARRAY_BUFFER, size, data, usage_to_gl(m_usage));
-    unbind();
 }
 
 void OpenGLVertexBuffer::update_data(size_t offset, const void* data, size_t size)
 {
+    if (m_stream)
+    {
+        if (!m_span) set_data(nullptr, m_size);
+        if (offset + size > m_span.size)
+        {
+            LOG_ERROR("ERROR::VERTEX::STREAM_OVERFLOW ({0} of {1})", offset + size, m_span.size);
+            return;
+        }
+        std::memcpy(m_span.data + offset, data, size);
+        m_stream->flush(m_span, offset, size);
+        return;
+    }
+
+    if (OpenGLState::hasDirectStateAccess())
+    {
+        glNamedBufferSubData(m_vbo, offset, size, data);
+        return;
+    }
     bind();
     glBufferSubData(GL_ARRAY_BUFFER, offset, size, data);
-    unbind();
+}
+
+void OpenGLVertexBuffer::begin_frame()
+{
+    if (!m_stream) return;
+    m_stream->begin_frame();
+    m_span = {};
+}
+
+void OpenGLVertexBuffer::set_stride(uint32_t stride)
+{
+    if (!m_stream || stride == 0 || stride == m_stride) return;
+
+    m_stride = stride;
+    // Частини кратні кроку, тож кожна починається з цілої вершини
+    size_t partitionSize = (m_stream->get_partition_size() + stride - 1) / stride * stride;
+    auto stream = std::make_unique<OpenGLStreamBuffer>(partitionSize);
+
+    // Дані з конструктора вже лежать у старому кільці: переносимо їх копіюванням
+    // на GPU, бо постійне відображення доступне лише для запису
+    StreamSpan span;
+    if (m_span)
+    {
+        span = stream->allocate(m_span.size, stride);
+        if (span && OpenGLState::hasDirectStateAccess())
+        {
+            glCopyNamedBufferSubData(m_stream->get_id(), stream->get_id(), m_span.offset, span.offset, m_span.size);
+        }
+        else if (span)
+        {
+            OpenGLState::bindBuffer(GL_COPY_READ_BUFFER, m_stream->get_id());
+            OpenGLState::bindBuffer(GL_COPY_WRITE_BUFFER, stream->get_id());
+            glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, m_span.offset, span.offset, m_span.size);
+        }
+    }
+
+    m_stream = std::move(stream);
+    m_vbo = m_stream->get_id();
+    m_span = span;
+}
+
+void OpenGLVertexBuffer::create_buffer(const void* data, size_t size)
+{
+    if (OpenGLState::hasDirectStateAccess())
+    {
+        glCreateBuffers(1, &m_vbo);
+        // Змінне сховище, як і без DSA: set_data може збільшити буфер на будь-якій версії GL
+        glNamedBufferData(m_vbo, size, data, usage_to_gl(m_usage));
+        return;
+    }
+
+    glGenBuffers(1, &m_vbo);
+    bind();
+    glBufferData(GL_ARRAY_BUFFER, size, data, usage_to_gl(m_usage));
 }
 
 GLenum OpenGLVertexBuffer::usage_to_gl(BufferUsage usage)
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include "EverEngineCore/rendering/buffers/VertexBuffer.h"
+#include "EverEngineCore/rendering/buffers/API/OpenGL/OpenGLStreamBuffer.h"
 #include "glad/glad.h"
 
 class OpenGLVertexBuffer : public VertexBuffer
@@ -18,11 +20,31 @@ public:
     void update_data(size_t offset, const void* data, size_t size) override;
 
     size_t get_size() const override { return m_size; }
+    size_t get_offset() const override { return m_span.offset; }
     GLuint get_id() const { return m_vbo; }
+
+    bool is_streaming() const { return m_stream != nullptr; }
+
+    void begin_frame() override;
+
+    /**
+     * @brief Вирівнює ділянки потокового буфера на крок вершини.
+     *
+     * Тоді зміщення даних завжди ціле число вершин і передається в малювання
+     * як base vertex. Перестворює буфер, тому викликається до налаштування VAO;
+     * уже залиті дані копіюються в нове кільце на GPU.
+     */
+    void set_stride(uint32_t stride);
 private:
     GLuint m_vbo = 0;
     size_t m_size = 0;
     BufferUsage m_usage;
 
+    std::unique_ptr<OpenGLStreamBuffer> m_stream;
+    StreamSpan m_span;
+    uint32_t m_stride = 1;
+
+    /// Створює буфер GL; з прямим доступом до стану - без прив'язки.
+    void create_buffer(const void* data, size_t size);
     GLenum usage_to_gl(BufferUsage usage);
 };
@@ -44,8 +44,18 @@ size_t BufferElement::get_components_count() const
     return 0;
 }
 
-BufferLayout::BufferLayout(const std::initializer_list<BufferElement>& elements)
-    : m_elements(elements)
+uint32_t BufferElement::get_attribute_slots() const
+{
+    switch (type)
+    {
+    case ShaderDataType::Mat3:      return 3;
+    case ShaderDataType::Mat4:      return 4;
+    default:                        return 1;
+    }
+}
+
+BufferLayout::BufferLayout(const std::initializer_list<BufferElement>& elements, uint32_t instanceDivisor)
+    : m_elements(elements), m_instanceDivisor(instanceDivisor)
     {
         calculate_offsets_and_stride();
     }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <initializer_list>
 #include <vector>
@@ -24,17 +25,26 @@ struct BufferElement
     BufferElement() = default;
     BufferElement(ShaderDataType type, const char* name, bool normalized = false);
 
+    /// Кількість компонентів в одному слоті атрибута (для матриць - у стовпці).
     size_t get_components_count() const;
+    /// Кількість слотів атрибутів (матриця займає слот на кожен стовпець).
+    uint32_t get_attribute_slots() const;
 };
 
 class BufferLayout
 {
 public:
     BufferLayout() = default;
-    BufferLayout(const std::initializer_list<BufferElement>& elements);
+    /**
+     * @param elements Атрибути буфера.
+     * @param instanceDivisor 0 - атрибути на вершину; N - атрибути змінюються раз на N екземплярів.
+     */
+    BufferLayout(const std::initializer_list<BufferElement>& elements, uint32_t instanceDivisor = 0);
 
     const std::vector<BufferElement>& get_elements() const { return m_elements; }
     uint32_t get_stride() const { return m_stride; }
+    uint32_t get_instance_divisor() const { return m_instanceDivisor; }
+    bool is_instanced() const { return m_instanceDivisor != 0; }
 
     std::vector<BufferElement>::iterator begin() { return m_elements.begin(); }
     std::vector<BufferElement>::iterator end() { return m_elements.end(); }
@@ -46,4 +56,5 @@ private:
     
     std::vector<BufferElement> m_elements;
     uint32_t  m_stride = 0;
+    uint32_t  m_instanceDivisor = 0;
 };
\ No newline at end of file
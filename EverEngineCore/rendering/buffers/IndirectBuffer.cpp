@@ -0,0 +1,13 @@
+#include "EverEngineCore/rendering/buffers/IndirectBuffer.h"
+#include "EverEngineCore/rendering/buffers/API/OpenGL/OpenGLIndirectBuffer.h"
+
+std::shared_ptr<IndirectBuffer> IndirectBuffer::create(uint32_t maxDraws, size_t drawDataStride)
+{
+    /** TODO: add dynamic API choose*/
+    return std::make_shared<OpenGLIndirectBuffer>(maxDraws, drawDataStride);
+}
+
+bool IndirectBuffer::is_supported()
+{
+    return OpenGLIndirectBuffer::is_supported();
+}
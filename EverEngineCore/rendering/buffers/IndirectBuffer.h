@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+/**
+ * @brief Команда непрямого малювання з індексами (розкладка DrawElementsIndirectCommand).
+ */
+struct DrawIndirectCommand
+{
+    uint32_t count = 0;             ///< Кількість індексів
+    uint32_t instanceCount = 1;
+    uint32_t firstIndex = 0;        ///< Перший індекс у буфері індексів VAO
+    int32_t baseVertex = 0;
+    uint32_t baseInstance = 0;
+};
+static_assert(sizeof(DrawIndirectCommand) == 20, "DrawIndirectCommand must match the GL layout");
+
+/**
+ * @brief Стандартні точки прив'язки буферів зберігання (SSBO).
+ */
+enum class StorageBinding : uint32_t
+{
+    DrawData = 0,   ///< Дані окремих команд IndirectBuffer, індексуються gl_DrawID
+    User = 1
+};
+
+/**
+ * @brief Набір команд для малювання багатьох мешів одного VAO одним викликом.
+ *
+ * Команди та дані кожної команди пишуться у потокові буфери, тож набір
+ * можна заповнювати щокадру без синхронізації з GPU. Дані команди i
+ * доступні шейдеру як елемент i буфера зберігання:
+ *
+ * @code
+ * #version 460 core
+ * struct DrawData { mat4 model; vec4 color; };
+ * layout(std430, binding = 0) readonly buffer DrawBuffer { DrawData u_Draws[]; };
+ * ...
+ * mat4 model = u_Draws[gl_DrawID].model;
+ * @endcode
+ *
+ * DrawIndirectCommand::baseVertex рахується від початку буфера вершин VAO,
+ * тому VAO з BufferUsage::Stream, чиї дані вже не на початку кільця
+ * (VertexArray::get_base_vertex() != 0), RendererAPI::drawIndirect відхиляє.
+ *
+ * Потребує GL 4.3 (glMultiDrawElementsIndirect, SSBO); gl_DrawID - GLSL 4.60
+ * або gl_DrawIDARB з розширенням GL_ARB_shader_draw_parameters.
+ */
+class IndirectBuffer
+{
+public:
+    virtual ~IndirectBuffer() = default;
+
+    /// Починає новий набір; попередній лишається дійсним для вже поданих викликів.
+    virtual void reset() = 0;
+
+    /**
+     * @brief Додає команду.
+     * @param drawData Дані команди розміром get_draw_data_stride() (може бути nullptr).
+     * @return Індекс команди (значення gl_DrawID) або UINT32_MAX, якщо набір заповнено.
+     */
+    virtual uint32_t add(const DrawIndirectCommand& command, const void* drawData = nullptr) = 0;
+
+    /// Робить набір видимим для GPU і прив'язує дані команд до точки binding.
+    virtual void bind(uint32_t binding = static_cast<uint32_t>(StorageBinding::DrawData)) = 0;
+
+    virtual uint32_t get_count() const = 0;
+    virtual uint32_t get_capacity() const = 0;
+    virtual size_t get_draw_data_stride() const = 0;
+    /// Зміщення першої команди поточного набору в буфері команд.
+    virtual size_t get_offset() const = 0;
+
+    /**
+     * @param maxDraws Найбільша кількість команд в одному наборі.
+     * @param drawDataStride Розмір даних однієї команди (крок масиву std430, 0 - без даних).
+     */
+    static std::shared_ptr<IndirectBuffer> create(uint32_t maxDraws, size_t drawDataStride);
+    /// Чи підтримує контекст непряме малювання.
+    static bool is_supported();
+};
@@ -0,0 +1,46 @@
+#include "EverEngineCore/rendering/buffers/UniformBuffer.h"
+#include "EverEngineCore/rendering/buffers/API/OpenGL/OpenGLUniformBuffer.h"
+
+#include <mutex>
+#include <unordered_map>
+
+namespace
+{
+    struct BlockRegistry
+    {
+        std::mutex mutex;
+        std::unordered_map<std::string, uint32_t> bindings{
+            { "FrameData",    static_cast<uint32_t>(UniformBinding::Frame) },
+            { "MaterialData", static_cast<uint32_t>(UniformBinding::Material) },
+            { "ObjectData",   static_cast<uint32_t>(UniformBinding::Object) }
+        };
+    };
+
+    BlockRegistry& registry()
+    {
+        static BlockRegistry s_registry;
+        return s_registry;
+    }
+}
+
+std::shared_ptr<UniformBuffer> UniformBuffer::create(size_t size, BufferUsage usage)
+{
+    /** TODO: add dynamic API choose*/
+    return std::make_shared<OpenGLUniformBuffer>(size, usage);
+}
+
+void UniformBuffer::register_block(const std::string& blockName, uint32_t binding)
+{
+    std::lock_guard lock(registry().mutex);
+    registry().bindings[blockName] = binding;
+}
+
+bool UniformBuffer::find_block_binding(std::string_view blockName, uint32_t& binding)
+{
+    std::lock_guard lock(registry().mutex);
+    auto it = registry().bindings.find(std::string(blockName));
+    if (it == registry().bindings.end()) return false;
+
+    binding = it->second;
+    return true;
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "EverEngineCore/rendering/buffers/VertexBuffer.h"
+
+/**
+ * @brief Стандартні точки прив'язки uniform-блоків.
+ *
+ * Шейдер оголошує блок з відповідним іменем (FrameData, MaterialData,
+ * ObjectData), і після лінкування блок автоматично прив'язується до точки.
+ * Власні блоки реєструються через UniformBuffer::register_block з точок від User.
+ */
+enum class UniformBinding : uint32_t
+{
+    Frame = 0,      ///< Камера, світло - раз на кадр
+    Material = 1,   ///< Параметри матеріалу
+    Object = 2,     ///< Матриця моделі та інші пер-об'єктні дані
+    User = 3
+};
+
+/**
+ * @brief Ділянка потокового uniform-буфера.
+ */
+struct UniformAllocation
+{
+    size_t offset = 0;
+    size_t size = 0;
+
+    explicit operator bool() const { return size != 0; }
+};
+
+/**
+ * @brief Буфер uniform-блоків, спільний для всіх програм.
+ *
+ * Static/Dynamic буфер містить один блок, який оновлюється set_data і
+ * прив'язується цілком. Stream буфер - велике кільце, з якого allocate()
+ * виділяє ділянки з вирівнюванням GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT;
+ * кожна ділянка прив'язується окремо через bind_range, тож дані кадру,
+ * матеріалів та об'єктів живуть в одному буфері з різними зміщеннями.
+ */
+class UniformBuffer
+{
+public:
+    virtual ~UniformBuffer() = default;
+
+    virtual void set_data(const void* data, size_t size, size_t offset = 0) = 0;
+
+    /**
+     * @brief Копіює data у нову ділянку (лише BufferUsage::Stream).
+     * @return Порожня ділянка, якщо дані не вміщаються.
+     */
+    virtual UniformAllocation allocate(const void* data, size_t size) = 0;
+
+    virtual void bind(uint32_t binding) const = 0;
+    virtual void bind_range(uint32_t binding, const UniformAllocation& allocation) const = 0;
+
+    virtual size_t get_size() const = 0;
+
+    /**
+     * @param size Розмір блоку, а для Stream - розмір однієї частини кільця.
+     */
+    static std::shared_ptr<UniformBuffer> create(size_t size, BufferUsage usage = BufferUsage::Dynamic);
+
+    /// Закріплює блок з іменем blockName за точкою binding у всіх шейдерах, що лінкуються після цього.
+    static void register_block(const std::string& blockName, uint32_t binding);
+    /// Шукає точку прив'язки блоку; false, якщо блок не зареєстровано.
+    static bool find_block_binding(std::string_view blockName, uint32_t& binding);
+};
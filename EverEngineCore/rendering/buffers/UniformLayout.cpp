@@ -0,0 +1,138 @@
+#include "EverEngineCore/rendering/buffers/UniformLayout.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace
+{
+    uint32_t align_up(uint32_t value, uint32_t alignment)
+    {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    /// Розмір значення без вирівнювання (як його зберігає CPU).
+    uint32_t packed_size(ShaderDataType type)
+    {
+        switch (type)
+        {
+        case ShaderDataType::Mat3:      return 4 * 3 * 3;
+        case ShaderDataType::Mat4:      return 4 * 4 * 4;
+        default:                        return UniformLayout::get_type_size(type);
+        }
+    }
+}
+
+UniformElement::UniformElement(ShaderDataType type, std::string name, uint32_t arrayCount)
+    : name(std::move(name)), type(type), arrayCount(std::max(arrayCount, 1u))
+    {}
+
+UniformLayout::UniformLayout(const std::initializer_list<UniformElement>& elements, UniformLayoutRule rule)
+    : m_elements(elements), m_rule(rule)
+    {
+        calculate_offsets();
+    }
+
+uint32_t UniformLayout::get_alignment(ShaderDataType type)
+{
+    switch (type)
+    {
+    case ShaderDataType::Float:
+    case ShaderDataType::Int:
+    case ShaderDataType::Bool:      return 4;
+    case ShaderDataType::Float2:
+    case ShaderDataType::Int2:      return 8;
+    case ShaderDataType::Float3:
+    case ShaderDataType::Int3:
+    case ShaderDataType::Float4:
+    case ShaderDataType::Int4:
+    case ShaderDataType::Mat3:
+    case ShaderDataType::Mat4:      return 16;
+    case ShaderDataType::None:      return 0;
+    }
+    return 0;
+}
+
+uint32_t UniformLayout::get_type_size(ShaderDataType type)
+{
+    switch (type)
+    {
+    case ShaderDataType::Float:
+    case ShaderDataType::Int:
+    case ShaderDataType::Bool:      return 4;
+    case ShaderDataType::Float2:
+    case ShaderDataType::Int2:      return 4 * 2;
+    case ShaderDataType::Float3:
+    case ShaderDataType::Int3:      return 4 * 3;
+    case ShaderDataType::Float4:
+    case ShaderDataType::Int4:      return 4 * 4;
+    case ShaderDataType::Mat3:      return 16 * 3;
+    case ShaderDataType::Mat4:      return 16 * 4;
+    case ShaderDataType::None:      return 0;
+    }
+    return 0;
+}
+
+void UniformLayout::calculate_offsets()
+{
+    uint32_t offset = 0;
+    uint32_t maxAlignment = 4;
+
+    for (auto& element : m_elements)
+    {
+        uint32_t alignment = get_alignment(element.type);
+        uint32_t size = get_type_size(element.type);
+        if (alignment == 0) continue;
+
+        if (element.arrayCount > 1)
+        {
+            // std140 вирівнює елементи масиву до vec4, std430 - лише до власного типу
+            if (m_rule == UniformLayoutRule::Std140) alignment = std::max(alignment, 16u);
+            element.stride = align_up(size, alignment);
+            element.size = element.stride * element.arrayCount;
+        }
+        else
+        {
+            element.stride = size;
+            element.size = size;
+        }
+
+        element.offset = align_up(offset, alignment);
+        offset = element.offset + element.size;
+        maxAlignment = std::max(maxAlignment, alignment);
+    }
+
+    // Блок std140 має розмір, кратний vec4, як структура
+    m_size = align_up(offset, m_rule == UniformLayoutRule::Std140 ? 16u : maxAlignment);
+}
+
+const UniformElement* UniformLayout::find(std::string_view name) const
+{
+    for (const auto& element : m_elements)
+    {
+        if (element.name == name) return &element;
+    }
+    return nullptr;
+}
+
+bool UniformLayout::write(void* block, std::string_view name, const void* value, uint32_t index) const
+{
+    const UniformElement* element = find(name);
+    if (!element || index >= element->arrayCount) return false;
+
+    uint8_t* destination = static_cast<uint8_t*>(block) + element->offset + index * element->stride;
+    const uint8_t* source = static_cast<const uint8_t*>(value);
+
+    if (element->type == ShaderDataType::Mat3)
+    {
+        // Кожен стовпець mat3 займає vec4
+        for (uint32_t column = 0; column < 3; column++)
+        {
+            std::memcpy(destination + column * 16, source + column * 12, 12);
+        }
+        return true;
+    }
+
+    std::memcpy(destination, source, packed_size(element->type));
+    return true;
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "EverEngineCore/rendering/buffers/BufferLayout.h"
+
+/**
+ * @brief Правила розміщення блоку в пам'яті буфера.
+ *
+ * Std140 - для uniform-блоків; Std430 - для shader storage блоків
+ * (масиви скалярів і vec2 без вирівнювання до 16 байт).
+ */
+enum class UniformLayoutRule
+{
+    Std140,
+    Std430
+};
+
+struct UniformElement
+{
+    std::string name;
+    ShaderDataType type;
+    uint32_t arrayCount;    ///< 1 - не масив
+    uint32_t offset = 0;
+    uint32_t stride = 0;    ///< Крок між елементами масиву
+    uint32_t size = 0;      ///< Розмір усього поля з урахуванням масиву
+
+    UniformElement(ShaderDataType type, std::string name, uint32_t arrayCount = 1);
+};
+
+/**
+ * @brief Розкладка uniform/storage блоку за правилами std140 або std430.
+ *
+ * Поля перелічуються в тому ж порядку, що й у GLSL-блоці; зміщення та
+ * загальний розмір обчислюються так само, як їх обчислить драйвер, тож
+ * дані можна збирати в байтовому масиві й заливати одним викликом.
+ *
+ * @code
+ * UniformLayout layout({
+ *     { ShaderDataType::Mat4,   "u_Model" },
+ *     { ShaderDataType::Float3, "u_Tint" },
+ *     { ShaderDataType::Float,  "u_Weights", 4 }
+ * });
+ * std::vector<uint8_t> block(layout.get_size());
+ * layout.write(block.data(), "u_Tint", &tint);
+ * layout.write(block.data(), "u_Weights", &weight, 2);   // u_Weights[2]
+ * @endcode
+ */
+class UniformLayout
+{
+public:
+    UniformLayout() = default;
+    UniformLayout(const std::initializer_list<UniformElement>& elements, UniformLayoutRule rule = UniformLayoutRule::Std140);
+
+    const std::vector<UniformElement>& get_elements() const { return m_elements; }
+    /// Розмір блоку з кінцевим вирівнюванням.
+    uint32_t get_size() const { return m_size; }
+    UniformLayoutRule get_rule() const { return m_rule; }
+
+    /// Повертає поле за іменем або nullptr.
+    const UniformElement* find(std::string_view name) const;
+
+    /**
+     * @brief Копіює значення поля у блок.
+     *
+     * Стовпці mat3 і елементи масивів розставляються з кроком розкладки,
+     * тому value - щільно упаковані дані (як у glm).
+     * @param index Індекс елемента масиву.
+     * @return false, якщо поля немає або index поза масивом.
+     */
+    bool write(void* block, std::string_view name, const void* value, uint32_t index = 0) const;
+
+    /// Базове вирівнювання та розмір типу (для mat3 - три стовпці по vec4).
+    static uint32_t get_alignment(ShaderDataType type);
+    static uint32_t get_type_size(ShaderDataType type);
+private:
+    void calculate_offsets();
+
+    std::vector<UniformElement> m_elements;
+    UniformLayoutRule m_rule = UniformLayoutRule::Std140;
+    uint32_t m_size = 0;
+};
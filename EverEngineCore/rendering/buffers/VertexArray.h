@@ -22,12 +22,18 @@ public:
     virtual void bind() const = 0;
     virtual void unbind() const = 0;
     virtual void draw(DrawMode mode = DrawMode::Triangles) const = 0;
+    /// Малює instanceCount екземплярів; атрибути екземплярів задаються буферами з instanceDivisor.
+    virtual void draw_instanced(DrawMode mode, uint32_t instanceCount) const = 0;
 
     virtual void add_vertex_buffer(const std::shared_ptr<VertexBuffer>& vbo, const BufferLayout& layout) = 0;
     virtual void set_index_buffer(const std::shared_ptr<IndexBuffer>& ebo) = 0;
 
     virtual const std::vector<std::shared_ptr<VertexBuffer>>& get_vertex_buffers() const = 0;
     virtual const std::shared_ptr<IndexBuffer>&  get_index_buffer() const = 0;
+    virtual size_t get_vertex_count() const = 0;
+    /// Перша вершина поточних даних потокового буфера (передається у виклики малювання).
+    virtual int32_t get_base_vertex() const = 0;
+    virtual uint32_t get_id() const = 0;
 
     static std::shared_ptr<VertexArray> create();
 };
\ No newline at end of file
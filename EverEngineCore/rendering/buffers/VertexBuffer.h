@@ -7,7 +7,7 @@ enum class BufferUsage
 {
     Static,
     Dynamic,
-    Stream
+    Stream      ///< Перезаписується щокадру; кожен set_data пише в нову ділянку кільцевого буфера
 };
 
 class VertexBuffer
@@ -22,6 +22,11 @@ public:
     virtual void update_data(size_t offset, const void* data, size_t size) = 0;
 
     virtual size_t get_size() const = 0;
+    /// Зміщення поточних даних у буфері в байтах (ненульове лише для BufferUsage::Stream).
+    virtual size_t get_offset() const = 0;
+
+    /// Початок кадру для BufferUsage::Stream: кільце переходить до наступної частини.
+    virtual void begin_frame() {}
 
     static std::shared_ptr<VertexBuffer> create(uint32_t size, BufferUsage usage = BufferUsage::Dynamic);
     static std::shared_ptr<VertexBuffer> create(const void* data, uint32_t size, BufferUsage usage = BufferUsage::Static);
@@ -1,4 +1,7 @@
 #include "EverEngineCore/rendering/renderer/API/OpenGL/OpenGLRendererAPI.h"
+#include "EverEngineCore/rendering/buffers/API/OpenGL/OpenGLVertexArray.h"
+#include "EverEngineCore/rendering/renderer/API/OpenGL/OpenGLState.h"
+#include "EverEngineCore/rendering/shader/API/OpenGL/OpenGLShader.h"
 #include <glad/glad.h>
 
 int OpenGLRendererAPI::init(void*(*loadProc)(const char*))
@@ -8,6 +11,8 @@ int OpenGLRendererAPI::init(void*(*loadProc)(const char*))
         LOG_CRIT("FAIL::INIT::GLAD");
         return -1;
     }
+    OpenGLState::reset();
+    OpenGLShader::init_parallel_compile(loadProc);
     return 0;
 };
 
@@ -19,4 +24,122 @@ void OpenGLRendererAPI::setClearColor(float r, float g, float b, float a)
 void OpenGLRendererAPI::clear()
 {
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-}
\ No newline at end of file
+}
+
+void OpenGLRendererAPI::setBlending(bool enabled)
+{
+    OpenGLState::setBlending(enabled);
+    if (enabled) OpenGLState::setBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+}
+
+void OpenGLRendererAPI::setDepthWrite(bool enabled)
+{
+    OpenGLState::setDepthWrite(enabled);
+}
+
+void OpenGLRendererAPI::setViewport(int32_t x, int32_t y, int32_t width, int32_t height)
+{
+    OpenGLState::setViewport(x, y, width, height);
+}
+
+void OpenGLRendererAPI::draw(const VertexArray& vertexArray, DrawMode mode)
+{
+    GLenum glMode = OpenGLVertexArray::draw_mode_to_gl(mode);
+    if (const auto& indexBuffer = vertexArray.get_index_buffer())
+    {
+        glDrawElementsBaseVertex(glMode, static_cast<GLsizei>(indexBuffer->get_count()), GL_UNSIGNED_INT, nullptr,
+            vertexArray.get_base_vertex());
+    }
+    else
+    {
+        glDrawArrays(glMode, vertexArray.get_base_vertex(), static_cast<GLsizei>(vertexArray.get_vertex_count()));
+    }
+}
+
+void OpenGLRendererAPI::drawInstanced(const VertexArray& vertexArray, DrawMode mode, uint32_t instanceCount)
+{
+    GLenum glMode = OpenGLVertexArray::draw_mode_to_gl(mode);
+    GLsizei instances = static_cast<GLsizei>(instanceCount);
+    if (const auto& indexBuffer = vertexArray.get_index_buffer())
+    {
+        glDrawElementsInstancedBaseVertex(glMode, static_cast<GLsizei>(indexBuffer->get_count()), GL_UNSIGNED_INT, nullptr,
+            instances, vertexArray.get_base_vertex());
+    }
+    else
+    {
+        glDrawArraysInstanced(glMode, vertexArray.get_base_vertex(), static_cast<GLsizei>(vertexArray.get_vertex_count()), instances);
+    }
+}
+
+void OpenGLRendererAPI::drawIndexed(const VertexArray& vertexArray, uint32_t indexCount, DrawMode mode)
+{
+    glDrawElementsBaseVertex(OpenGLVertexArray::draw_mode_to_gl(mode), static_cast<GLsizei>(indexCount), GL_UNSIGNED_INT, nullptr,
+        vertexArray.get_base_vertex());
+}
+
+void OpenGLRendererAPI::drawIndirect(const VertexArray& vertexArray, DrawMode mode, IndirectBuffer& commands)
+{
+    if (commands.get_count() == 0) return;
+    if (!vertexArray.get_index_buffer())
+    {
+        LOG_ERROR("ERROR::RENDERER::INDIRECT_WITHOUT_INDICES");
+        return;
+    }
+    // baseVertex команд записаний заздалегідь і не знає, де зараз дані потокового буфера
+    if (vertexArray.get_base_vertex() != 0)
+    {
+        LOG_ERROR("ERROR::RENDERER::INDIRECT_WITH_STREAMED_VERTICES");
+        return;
+    }
+
+    // IndexBuffer зберігає лише unsigned int, тож тип індексів завжди GL_UNSIGNED_INT
+    static_assert(sizeof(unsigned int) == sizeof(GLuint), "IndexBuffer indices must match GL_UNSIGNED_INT");
+    commands.bind();
+    glMultiDrawElementsIndirect(OpenGLVertexArray::draw_mode_to_gl(mode), GL_UNSIGNED_INT,
+        reinterpret_cast<const void*>(commands.get_offset()), static_cast<GLsizei>(commands.get_count()), 0);
+}
+
+uint32_t OpenGLRendererAPI::createTexture(uint32_t width, uint32_t height, const void* rgba)
+{
+    GLuint texture = 0;
+    if (OpenGLState::hasDirectStateAccess())
+    {
+        glCreateTextures(GL_TEXTURE_2D, 1, &texture);
+        glTextureParameteri(texture, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTextureParameteri(texture, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTextureParameteri(texture, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTextureParameteri(texture, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glTextureStorage2D(texture, 1, GL_RGBA8, static_cast<GLsizei>(width), static_cast<GLsizei>(height));
+        if (rgba)
+        {
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+            glTextureSubImage2D(texture, 0, 0, 0, static_cast<GLsizei>(width), static_cast<GLsizei>(height),
+                GL_RGBA, GL_UNSIGNED_BYTE, rgba);
+        }
+        return texture;
+    }
+
+    glGenTextures(1, &texture);
+    OpenGLState::bindTexture(0, GL_TEXTURE_2D, texture);
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, static_cast<GLsizei>(width), static_cast<GLsizei>(height),
+        0, GL_RGBA, GL_UNSIGNED_BYTE, rgba);
+    return texture;
+}
+
+void OpenGLRendererAPI::deleteTexture(uint32_t texture)
+{
+    if (texture == 0) return;
+    OpenGLState::onTextureDeleted(texture);
+    glDeleteTextures(1, &texture);
+}
+
+void OpenGLRendererAPI::bindTexture(uint32_t slot, uint32_t texture)
+{
+    OpenGLState::bindTexture(slot, GL_TEXTURE_2D, texture);
+}
@@ -7,4 +7,16 @@ public:
     int init(void*(*)(const char*)) override;
     void setClearColor(float r, float g, float b, float a) override;
     void clear() override;
+
+    void setBlending(bool enabled) override;
+    void setDepthWrite(bool enabled) override;
+    void setViewport(int32_t x, int32_t y, int32_t width, int32_t height) override;
+    void draw(const VertexArray& vertexArray, DrawMode mode) override;
+    void drawInstanced(const VertexArray& vertexArray, DrawMode mode, uint32_t instanceCount) override;
+    void drawIndexed(const VertexArray& vertexArray, uint32_t indexCount, DrawMode mode) override;
+    void drawIndirect(const VertexArray& vertexArray, DrawMode mode, IndirectBuffer& commands) override;
+
+    uint32_t createTexture(uint32_t width, uint32_t height, const void* rgba) override;
+    void deleteTexture(uint32_t texture) override;
+    void bindTexture(uint32_t slot, uint32_t texture) override;
 };
\ No newline at end of file
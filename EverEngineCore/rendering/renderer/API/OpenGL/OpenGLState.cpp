@@ -0,0 +1,305 @@
+#include "EverEngineCore/rendering/renderer/API/OpenGL/OpenGLState.h"
+
+#include <array>
+
+namespace
+{
+    /// Значення, якого не буває у GL: перший виклик завжди йде драйверу.
+    constexpr GLuint k_unknown = ~0u;
+    constexpr uint32_t k_maxTextureUnits = 32;
+    constexpr uint32_t k_maxIndexedBindings = 16;
+
+    enum BufferSlot : uint32_t
+    {
+        ArrayBuffer,
+        ElementArrayBuffer,
+        UniformBuffer,
+        ShaderStorageBuffer,
+        DrawIndirectBuffer,
+        CopyReadBuffer,
+        CopyWriteBuffer,
+        PixelUnpackBuffer,
+        BufferSlotCount
+    };
+
+    struct TextureBinding
+    {
+        GLenum target = 0;
+        GLuint texture = k_unknown;
+    };
+
+    struct RangeBinding
+    {
+        GLuint buffer = k_unknown;
+        GLintptr offset = 0;
+        GLsizeiptr size = 0;
+    };
+
+    /// Логічні прапорці: 0 - вимкнено, 1 - увімкнено, k_unknown - невідомо.
+    struct GLStateShadow
+    {
+        GLuint program = k_unknown;
+        GLuint pipeline = k_unknown;
+        GLuint vertexArray = k_unknown;
+        std::array<GLuint, BufferSlotCount> buffers;
+        std::array<TextureBinding, k_maxTextureUnits> textures;
+        std::array<RangeBinding, k_maxIndexedBindings> uniformRanges;
+        std::array<RangeBinding, k_maxIndexedBindings> storageRanges;
+        GLuint activeTexture = k_unknown;
+
+        GLuint blending = k_unknown;
+        GLenum blendSource = k_unknown;
+        GLenum blendDestination = k_unknown;
+        GLuint depthTest = k_unknown;
+        GLuint depthWrite = k_unknown;
+        GLenum depthFunc = k_unknown;
+        GLuint culling = k_unknown;
+        GLenum cullFace = k_unknown;
+        std::array<int32_t, 4> viewport{ -1, -1, -1, -1 };
+
+        GLStateShadow()
+        {
+            buffers.fill(k_unknown);
+        }
+    };
+
+    GLStateShadow s_state;
+    GLStateStats s_stats;
+
+    BufferSlot buffer_slot(GLenum target)
+    {
+        switch (target)
+        {
+        case GL_ARRAY_BUFFER:           return ArrayBuffer;
+        case GL_ELEMENT_ARRAY_BUFFER:   return ElementArrayBuffer;
+        case GL_UNIFORM_BUFFER:         return UniformBuffer;
+        case GL_SHADER_STORAGE_BUFFER:  return ShaderStorageBuffer;
+        case GL_DRAW_INDIRECT_BUFFER:   return DrawIndirectBuffer;
+        case GL_COPY_READ_BUFFER:       return CopyReadBuffer;
+        case GL_COPY_WRITE_BUFFER:      return CopyWriteBuffer;
+        case GL_PIXEL_UNPACK_BUFFER:    return PixelUnpackBuffer;
+        default:                        return BufferSlotCount;
+        }
+    }
+
+    /// Оновлює тіньове значення; повертає true, якщо виклик потрібен.
+    template<typename T>
+    bool change(T& shadow, T value)
+    {
+        if (shadow == value)
+        {
+            s_stats.skipped++;
+            return false;
+        }
+        shadow = value;
+        s_stats.issued++;
+        return true;
+    }
+
+    void set_capability(GLuint& shadow, GLenum capability, bool enabled)
+    {
+        if (!change(shadow, enabled ? 1u : 0u)) return;
+        if (enabled) glEnable(capability);
+        else glDisable(capability);
+    }
+}
+
+void OpenGLState::reset()
+{
+    s_state = GLStateShadow();
+}
+
+void OpenGLState::useProgram(GLuint program)
+{
+    if (change(s_state.program, program)) glUseProgram(program);
+}
+
+void OpenGLState::bindProgramPipeline(GLuint pipeline)
+{
+    useProgram(0);
+    if (change(s_state.pipeline, pipeline)) glBindProgramPipeline(pipeline);
+}
+
+void OpenGLState::bindVertexArray(GLuint vertexArray)
+{
+    if (!change(s_state.vertexArray, vertexArray)) return;
+    glBindVertexArray(vertexArray);
+    s_state.buffers[ElementArrayBuffer] = k_unknown;
+}
+
+void OpenGLState::bindBuffer(GLenum target, GLuint buffer)
+{
+    BufferSlot slot = buffer_slot(target);
+    if (slot == BufferSlotCount)
+    {
+        s_stats.issued++;
+        glBindBuffer(target, buffer);
+        return;
+    }
+    if (change(s_state.buffers[slot], buffer)) glBindBuffer(target, buffer);
+}
+
+void OpenGLState::bindBufferRange(GLenum target, uint32_t index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    std::array<RangeBinding, k_maxIndexedBindings>* ranges = nullptr;
+    if (target == GL_UNIFORM_BUFFER) ranges = &s_state.uniformRanges;
+    else if (target == GL_SHADER_STORAGE_BUFFER) ranges = &s_state.storageRanges;
+
+    if (ranges && index < k_maxIndexedBindings)
+    {
+        RangeBinding& binding = (*ranges)[index];
+        if (binding.buffer == buffer && binding.offset == offset && binding.size == size)
+        {
+            s_stats.skipped++;
+            return;
+        }
+        binding = { buffer, offset, size };
+    }
+
+    // glBindBufferRange змінює й загальну точку прив'язки, тож тінь оновлюємо
+    // лише тоді, коли виклик справді пішов драйверу.
+    BufferSlot slot = buffer_slot(target);
+    if (slot != BufferSlotCount) s_state.buffers[slot] = buffer;
+
+    s_stats.issued++;
+    glBindBufferRange(target, index, buffer, offset, size);
+}
+
+void OpenGLState::bindTexture(uint32_t unit, GLenum target, GLuint texture)
+{
+    if (unit >= k_maxTextureUnits)
+    {
+        s_stats.issued += 2;
+        s_state.activeTexture = k_unknown;
+        glActiveTexture(GL_TEXTURE0 + unit);
+        glBindTexture(target, texture);
+        return;
+    }
+
+    TextureBinding& binding = s_state.textures[unit];
+    if (binding.target == target && binding.texture == texture)
+    {
+        s_stats.skipped++;
+        return;
+    }
+
+    if (change(s_state.activeTexture, static_cast<GLuint>(unit))) glActiveTexture(GL_TEXTURE0 + unit);
+    binding = { target, texture };
+    s_stats.issued++;
+    glBindTexture(target, texture);
+}
+
+void OpenGLState::setBlending(bool enabled)
+{
+    set_capability(s_state.blending, GL_BLEND, enabled);
+}
+
+void OpenGLState::setBlendFunc(GLenum source, GLenum destination)
+{
+    if (s_state.blendSource == source && s_state.blendDestination == destination)
+    {
+        s_stats.skipped++;
+        return;
+    }
+    s_state.blendSource = source;
+    s_state.blendDestination = destination;
+    s_stats.issued++;
+    glBlendFunc(source, destination);
+}
+
+void OpenGLState::setDepthTest(bool enabled)
+{
+    set_capability(s_state.depthTest, GL_DEPTH_TEST, enabled);
+}
+
+void OpenGLState::setDepthWrite(bool enabled)
+{
+    if (change(s_state.depthWrite, enabled ? 1u : 0u)) glDepthMask(enabled ? GL_TRUE : GL_FALSE);
+}
+
+void OpenGLState::setDepthFunc(GLenum func)
+{
+    if (change(s_state.depthFunc, func)) glDepthFunc(func);
+}
+
+void OpenGLState::setCulling(bool enabled)
+{
+    set_capability(s_state.culling, GL_CULL_FACE, enabled);
+}
+
+void OpenGLState::setCullFace(GLenum face)
+{
+    if (change(s_state.cullFace, face)) glCullFace(face);
+}
+
+void OpenGLState::setViewport(int32_t x, int32_t y, int32_t width, int32_t height)
+{
+    if (change(s_state.viewport, { x, y, width, height })) glViewport(x, y, width, height);
+}
+
+void OpenGLState::onProgramDeleted(GLuint program)
+{
+    if (s_state.program == program) s_state.program = k_unknown;
+}
+
+void OpenGLState::onProgramPipelineDeleted(GLuint pipeline)
+{
+    if (s_state.pipeline == pipeline) s_state.pipeline = 0;
+}
+
+void OpenGLState::onVertexArrayDeleted(GLuint vertexArray)
+{
+    if (s_state.vertexArray != vertexArray) return;
+    s_state.vertexArray = 0;
+    s_state.buffers[ElementArrayBuffer] = k_unknown;
+}
+
+void OpenGLState::onBufferDeleted(GLuint buffer)
+{
+    for (GLuint& binding : s_state.buffers)
+    {
+        if (binding == buffer) binding = 0;
+    }
+    // Новий буфер може отримати той самий ідентифікатор, тож індексовані точки треба прив'язати заново
+    for (RangeBinding& binding : s_state.uniformRanges)
+    {
+        if (binding.buffer == buffer) binding.buffer = k_unknown;
+    }
+    for (RangeBinding& binding : s_state.storageRanges)
+    {
+        if (binding.buffer == buffer) binding.buffer = k_unknown;
+    }
+}
+
+void OpenGLState::onTextureDeleted(GLuint texture)
+{
+    for (TextureBinding& binding : s_state.textures)
+    {
+        if (binding.texture == texture) binding.texture = 0;
+    }
+}
+
+bool OpenGLState::hasDirectStateAccess()
+{
+    return GLAD_GL_VERSION_4_5 != 0;
+}
+
+GLuint OpenGLState::getProgram()
+{
+    return s_state.program;
+}
+
+GLuint OpenGLState::getVertexArray()
+{
+    return s_state.vertexArray;
+}
+
+const GLStateStats& OpenGLState::getStats()
+{
+    return s_stats;
+}
+
+void OpenGLState::resetStats()
+{
+    s_stats = {};
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstdint>
+#include <glad/glad.h>
+
+/**
+ * @brief Лічильники викликів GL, що пройшли через OpenGLState.
+ */
+struct GLStateStats
+{
+    uint64_t issued = 0;    ///< Виклики, передані драйверу
+    uint64_t skipped = 0;   ///< Надлишкові виклики, що були відкинуті
+};
+
+/**
+ * @brief Тіньова копія стану контексту OpenGL.
+ *
+ * Зберігає поточні програму, VAO, прив'язки буферів і текстур, стан
+ * змішування, глибини, відсікання граней та viewport і пропускає виклики,
+ * що не змінюють стан. Прив'язка GL_ELEMENT_ARRAY_BUFFER є частиною VAO,
+ * тому після зміни VAO вона вважається невідомою.
+ *
+ * Весь код рушія має змінювати цей стан лише через OpenGLState; після
+ * стороннього коду, що працює з GL напряму, потрібно викликати reset().
+ * Клас не потокобезпечний - як і контекст GL, він належить потоку рендерингу.
+ */
+class OpenGLState
+{
+public:
+    /**
+     * @brief Позначає весь стан невідомим (наступні виклики підуть драйверу).
+     */
+    static void reset();
+
+    static void useProgram(GLuint program);
+    /// Прив'язує конвеєр програм; поточна програма скидається в 0, бо вона мала б пріоритет.
+    static void bindProgramPipeline(GLuint pipeline);
+    static void bindVertexArray(GLuint vertexArray);
+    static void bindBuffer(GLenum target, GLuint buffer);
+
+    /**
+     * @brief Прив'язує ділянку буфера до індексованої точки (glBindBufferRange).
+     *
+     * Як і в GL, змінює також загальну прив'язку target.
+     */
+    static void bindBufferRange(GLenum target, uint32_t index, GLuint buffer, GLintptr offset, GLsizeiptr size);
+
+    /**
+     * @brief Прив'язує текстуру до блоку (glActiveTexture + glBindTexture).
+     */
+    static void bindTexture(uint32_t unit, GLenum target, GLuint texture);
+
+    static void setBlending(bool enabled);
+    static void setBlendFunc(GLenum source, GLenum destination);
+    static void setDepthTest(bool enabled);
+    static void setDepthWrite(bool enabled);
+    static void setDepthFunc(GLenum func);
+    static void setCulling(bool enabled);
+    static void setCullFace(GLenum face);
+    static void setViewport(int32_t x, int32_t y, int32_t width, int32_t height);
+
+    /// Видалені об'єкти скидаються з тіньового стану (GL відв'язує їх сам).
+    static void onProgramDeleted(GLuint program);
+    static void onProgramPipelineDeleted(GLuint pipeline);
+    static void onVertexArrayDeleted(GLuint vertexArray);
+    static void onBufferDeleted(GLuint buffer);
+    static void onTextureDeleted(GLuint texture);
+
+    /**
+     * @brief Чи доступний прямий доступ до стану (GL 4.5).
+     *
+     * Тоді об'єкти створюються і змінюються за ідентифікатором (glCreate*,
+     * glNamed*, glVertexArray*) без прив'язки, і прив'язки лишаються тільки
+     * для малювання.
+     */
+    static bool hasDirectStateAccess();
+
+    static GLuint getProgram();
+    static GLuint getVertexArray();
+
+    static const GLStateStats& getStats();
+    static void resetStats();
+};
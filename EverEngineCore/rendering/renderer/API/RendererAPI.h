@@ -1,6 +1,8 @@
 #pragma once
 
 #include "EverEngineCore/core/Log.h"
+#include "EverEngineCore/rendering/buffers/VertexArray.h"
+#include "EverEngineCore/rendering/buffers/IndirectBuffer.h"
 
 enum class APIType
 {
@@ -17,4 +19,23 @@ public:
     virtual int init(void*(*)(const char*)) = 0;
     virtual void setClearColor(float r, float g, float b, float a) = 0;
     virtual void clear() = 0;
+
+    virtual void setBlending(bool enabled) = 0;
+    virtual void setDepthWrite(bool enabled) = 0;
+    virtual void setViewport(int32_t x, int32_t y, int32_t width, int32_t height) = 0;
+
+    /// Малює прив'язаний VAO (без повторного bind/unbind).
+    virtual void draw(const VertexArray& vertexArray, DrawMode mode) = 0;
+    /// Малює instanceCount екземплярів прив'язаного VAO.
+    virtual void drawInstanced(const VertexArray& vertexArray, DrawMode mode, uint32_t instanceCount) = 0;
+    /// Малює перші indexCount індексів прив'язаного VAO.
+    virtual void drawIndexed(const VertexArray& vertexArray, uint32_t indexCount, DrawMode mode) = 0;
+    /// Малює всі команди набору одним викликом; VAO має бути прив'язаний і мати буфер
+    /// 32-бітних індексів (єдиний тип, який створює IndexBuffer) і нульову базову вершину.
+    virtual void drawIndirect(const VertexArray& vertexArray, DrawMode mode, IndirectBuffer& commands) = 0;
+
+    /// Створює 2D-текстуру RGBA8 і повертає її ідентифікатор.
+    virtual uint32_t createTexture(uint32_t width, uint32_t height, const void* rgba) = 0;
+    virtual void deleteTexture(uint32_t texture) = 0;
+    virtual void bindTexture(uint32_t slot, uint32_t texture) = 0;
 };
\ No newline at end of file
@@ -0,0 +1,210 @@
+#include "EverEngineCore/rendering/renderer/RenderQueue.h"
+#include "EverEngineCore/rendering/renderer/API/RendererAPI.h"
+#include "EverEngineCore/rendering/buffers/UniformBuffer.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+
+namespace
+{
+    constexpr uint32_t k_layerShift = 56;
+    constexpr uint32_t k_bucketShift = 55;
+
+    constexpr uint32_t k_depthBits = 20;
+    constexpr uint32_t k_shaderBits = 12;
+    constexpr uint32_t k_materialBits = 12;
+    constexpr uint32_t k_vertexArrayBits = 11;
+
+    constexpr uint64_t mask(uint32_t bits) { return (1ull << bits) - 1; }
+
+    /**
+     * @brief Квантує глибину у k_depthBits біт зі збереженням порядку.
+     *
+     * Для невід'ємних float порядок бітового подання збігається з порядком
+     * значень, тож старші біти дають логарифмічну шкалу без відомої далекої площини.
+     */
+    uint64_t quantize_depth(float depth)
+    {
+        if (!(depth > 0.0f)) return 0;
+        return std::bit_cast<uint32_t>(depth) >> (31 - k_depthBits);
+    }
+}
+
+void RenderQueue::submit(const RenderPacket& packet)
+{
+    if (!packet.vertexArray || !packet.shader)
+    {
+        LOG_WARN("WARN::RENDER_QUEUE::INCOMPLETE_PACKET");
+        return;
+    }
+    m_packets.push_back(packet);
+}
+
+void RenderQueue::clear()
+{
+    m_packets.clear();
+}
+
+uint64_t RenderQueue::makeKey(const RenderPacket& packet)
+{
+    uint64_t shader = packet.shader->get_id() & mask(k_shaderBits);
+    uint64_t material = packet.material & mask(k_materialBits);
+    uint64_t vertexArray = packet.vertexArray->get_id() & mask(k_vertexArrayBits);
+    uint64_t depth = quantize_depth(packet.depth);
+
+    uint64_t key = (static_cast<uint64_t>(packet.layer) << k_layerShift) |
+                   (static_cast<uint64_t>(packet.bucket) << k_bucketShift);
+
+    if (packet.bucket == RenderBucket::Opaque)
+    {
+        key |= shader << (k_materialBits + k_vertexArrayBits + k_depthBits);
+        key |= material << (k_vertexArrayBits + k_depthBits);
+        key |= vertexArray << k_depthBits;
+        key |= depth;
+    }
+    else
+    {
+        key |= (mask(k_depthBits) - depth) << (k_shaderBits + k_materialBits + k_vertexArrayBits);
+        key |= shader << (k_materialBits + k_vertexArrayBits);
+        key |= material << k_vertexArrayBits;
+        key |= vertexArray;
+    }
+    return key;
+}
+
+void RenderQueue::radixSort(std::vector<uint64_t>& keys, std::vector<uint32_t>& indices)
+{
+    thread_local std::vector<uint64_t> keyScratch;
+    thread_local std::vector<uint32_t> indexScratch;
+
+    const size_t count = keys.size();
+    if (count < 2) return;
+    keyScratch.resize(count);
+    indexScratch.resize(count);
+
+    // Гістограми всіх восьми байтів за один прохід
+    std::array<std::array<uint32_t, 256>, 8> histograms{};
+    for (uint64_t key : keys)
+    {
+        for (uint32_t pass = 0; pass < 8; pass++)
+        {
+            histograms[pass][(key >> (pass * 8)) & 0xFF]++;
+        }
+    }
+
+    uint64_t* srcKeys = keys.data();
+    uint32_t* srcIndices = indices.data();
+    uint64_t* dstKeys = keyScratch.data();
+    uint32_t* dstIndices = indexScratch.data();
+
+    for (uint32_t pass = 0; pass < 8; pass++)
+    {
+        auto& histogram = histograms[pass];
+        const uint32_t shift = pass * 8;
+
+        // Усі ключі мають однаковий байт - прохід нічого не змінить
+        if (histogram[(srcKeys[0] >> shift) & 0xFF] == count) continue;
+
+        uint32_t offset = 0;
+        for (uint32_t& bin : histogram)
+        {
+            uint32_t binCount = bin;
+            bin = offset;
+            offset += binCount;
+        }
+
+        for (size_t i = 0; i < count; i++)
+        {
+            uint32_t position = histogram[(srcKeys[i] >> shift) & 0xFF]++;
+            dstKeys[position] = srcKeys[i];
+            dstIndices[position] = srcIndices[i];
+        }
+
+        std::swap(srcKeys, dstKeys);
+        std::swap(srcIndices, dstIndices);
+    }
+
+    if (srcKeys != keys.data())
+    {
+        std::copy_n(srcKeys, count, keys.data());
+        std::copy_n(srcIndices, count, indices.data());
+    }
+}
+
+void RenderQueue::execute(RendererAPI& api, UniformBuffer* uniforms)
+{
+    m_stats = {};
+    if (m_packets.empty()) return;
+
+    m_keys.resize(m_packets.size());
+    m_order.resize(m_packets.size());
+    for (size_t i = 0; i < m_packets.size(); i++)
+    {
+        m_keys[i] = makeKey(m_packets[i]);
+        m_order[i] = static_cast<uint32_t>(i);
+    }
+    radixSort(m_keys, m_order);
+
+    const Shader* currentShader = nullptr;
+    const VertexArray* currentVertexArray = nullptr;
+    const void* currentMaterial = nullptr;
+    bool blending = false;
+
+    for (uint32_t index : m_order)
+    {
+        const RenderPacket& packet = m_packets[index];
+
+        bool transparent = packet.bucket == RenderBucket::Transparent;
+        if (transparent != blending)
+        {
+            api.setBlending(transparent);
+            api.setDepthWrite(!transparent);
+            blending = transparent;
+        }
+
+        if (packet.shader != currentShader)
+        {
+            packet.shader->bind();
+            currentShader = packet.shader;
+            m_stats.shaderChanges++;
+        }
+
+        if (packet.vertexArray != currentVertexArray)
+        {
+            packet.vertexArray->bind();
+            currentVertexArray = packet.vertexArray;
+            m_stats.vertexArrayChanges++;
+        }
+
+        if (uniforms)
+        {
+            // Пакети відсортовані за матеріалом, тож блок матеріалу заливається раз на групу
+            if (packet.materialData && packet.materialData != currentMaterial)
+            {
+                uniforms->bind_range(static_cast<uint32_t>(UniformBinding::Material),
+                    uniforms->allocate(packet.materialData, packet.materialDataSize));
+                currentMaterial = packet.materialData;
+            }
+            if (packet.objectData)
+            {
+                uniforms->bind_range(static_cast<uint32_t>(UniformBinding::Object),
+                    uniforms->allocate(packet.objectData, packet.objectDataSize));
+            }
+        }
+
+        if (packet.setup) packet.setup(*packet.shader, packet.userData);
+
+        if (packet.instanceCount > 1) api.drawInstanced(*packet.vertexArray, packet.mode, packet.instanceCount);
+        else api.draw(*packet.vertexArray, packet.mode);
+        m_stats.drawCalls++;
+    }
+
+    if (blending)
+    {
+        api.setBlending(false);
+        api.setDepthWrite(true);
+    }
+
+    m_packets.clear();
+}
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "EverEngineCore/rendering/buffers/VertexArray.h"
+#include "EverEngineCore/rendering/shader/Shader.h"
+
+class RendererAPI;
+class UniformBuffer;
+
+/**
+ * @brief Кошик черги: непрозорі об'єкти малюються першими, спереду назад,
+ *        прозорі - після них, ззаду наперед.
+ */
+enum class RenderBucket : uint8_t
+{
+    Opaque,
+    Transparent
+};
+
+/**
+ * @brief Один виклик малювання у черзі.
+ *
+ * Пакет не володіє ресурсами: VAO, шейдер, userData та дані блоків мають
+ * жити до Renderer::endScene(). Пер-об'єктні параметри передаються блоком
+ * objectData (ObjectData у шейдері) або встановлюються в setup.
+ */
+struct RenderPacket
+{
+    const VertexArray* vertexArray = nullptr;
+    Shader* shader = nullptr;
+    DrawMode mode = DrawMode::Triangles;
+    RenderBucket bucket = RenderBucket::Opaque;
+    uint8_t layer = 0;          ///< Шар (UI, світ, небо...); менший малюється раніше
+    uint16_t material = 0;      ///< Ідентифікатор набору параметрів матеріалу
+    float depth = 0.0f;         ///< Відстань до камери (>= 0)
+    uint32_t instanceCount = 1; ///< Більше 1 - інстансоване малювання (атрибути екземплярів у VAO)
+
+    /// Вміст блоку MaterialData (std140); заливається, коли змінюється material.
+    const void* materialData = nullptr;
+    uint32_t materialDataSize = 0;
+    /// Вміст блоку ObjectData (std140); заливається для кожного пакета.
+    const void* objectData = nullptr;
+    uint32_t objectDataSize = 0;
+
+    /// Встановлює пер-об'єктні параметри; шейдер уже прив'язаний.
+    void (*setup)(Shader& shader, const void* userData) = nullptr;
+    const void* userData = nullptr;
+};
+
+/**
+ * @brief Статистика останнього виконання черги.
+ */
+struct RenderQueueStats
+{
+    uint32_t drawCalls = 0;
+    uint32_t shaderChanges = 0;
+    uint32_t vertexArrayChanges = 0;
+};
+
+/**
+ * @brief Черга малювання з 64-бітними ключами сортування.
+ *
+ * Ключ непрозорого пакета: шар | шейдер | матеріал | VAO | глибина, тож
+ * пакети групуються за станом, а в межах одного стану йдуть спереду назад.
+ * Ключ прозорого пакета: шар | інвертована глибина | шейдер | матеріал | VAO,
+ * бо для змішування порядок ззаду наперед важливіший за зміну стану.
+ * Ключі сортуються поразрядним сортуванням (LSD radix, 8 біт за прохід;
+ * проходи, у яких усі ключі мають однаковий байт, пропускаються), а
+ * виконання прив'язує шейдер та VAO лише при їх зміні.
+ *
+ * @code
+ * Renderer::beginScene();
+ * Renderer::submit({ .vertexArray = cube.get(), .shader = shader.get(), .depth = distance });
+ * Renderer::endScene();
+ * @endcode
+ */
+class RenderQueue
+{
+public:
+    /**
+     * @brief Додає пакет у чергу.
+     */
+    void submit(const RenderPacket& packet);
+
+    /**
+     * @brief Сортує пакети та виконує їх через RendererAPI, після чого очищує чергу.
+     * @param uniforms Потоковий буфер для блоків матеріалів та об'єктів (nullptr - блоки ігноруються).
+     */
+    void execute(RendererAPI& api, UniformBuffer* uniforms = nullptr);
+
+    /**
+     * @brief Видаляє всі пакети без виконання.
+     */
+    void clear();
+
+    size_t size() const { return m_packets.size(); }
+    const RenderQueueStats& getStats() const { return m_stats; }
+
+    /**
+     * @brief Обчислює ключ сортування пакета.
+     */
+    static uint64_t makeKey(const RenderPacket& packet);
+
+    /**
+     * @brief Сортує ключі за зростанням, переставляючи індекси разом із ними.
+     * @param keys Ключі (сортуються на місці).
+     * @param indices Індекси пакетів (переставляються так само, як ключі).
+     */
+    static void radixSort(std::vector<uint64_t>& keys, std::vector<uint32_t>& indices);
+
+private:
+    std::vector<RenderPacket> m_packets;
+    std::vector<uint64_t> m_keys;
+    std::vector<uint32_t> m_order;
+    RenderQueueStats m_stats;
+};
@@ -1,7 +1,19 @@
 #include "EverEngineCore/rendering/renderer/Renderer.h"
+#include "EverEngineCore/rendering/renderer/Renderer2D.h"
 #include "EverEngineCore/rendering/renderer/API/OpenGL/OpenGLRendererAPI.h"
+#include "EverEngineCore/rendering/shader/API/OpenGL/OpenGLPipelineCache.h"
 
 std::unique_ptr<RendererAPI> Renderer::m_api = nullptr;
+RenderQueue Renderer::m_queue;
+std::shared_ptr<UniformBuffer> Renderer::m_uniforms = nullptr;
+
+namespace
+{
+    /// Розмір частини кільця uniform-блоків; за кадр стільки даних на кожну частину.
+    constexpr size_t k_uniformPartitionSize = 4u << 20;
+
+    static_assert(sizeof(FrameUniforms) == 3 * 64 + 4 * 16, "FrameUniforms must match the std140 FrameData block");
+}
 
 int Renderer::init(void*(*loader)(const char*), APIType api)
 {
@@ -15,7 +27,19 @@ int Renderer::init(void*(*loader)(const char*), APIType api)
         LOG_ERROR("ERROR::UNSUPPORTED::RENDERER_API");
         return -1;
     }
-    return m_api->init(loader);
+    int result = m_api->init(loader);
+    if (result == 0) m_uniforms = UniformBuffer::create(k_uniformPartitionSize, BufferUsage::Stream);
+    return result;
+}
+
+void Renderer::shutdown()
+{
+    // Ресурси Renderer2D звільняються, поки контекст GL ще існує
+    Renderer2D::shutdown();
+    m_queue.clear();
+    m_uniforms.reset();
+    OpenGLPipelineCache::clear();
+    m_api.reset();
 }
 
 void Renderer::setClearColor(float r, float g, float b, float a)
@@ -39,3 +63,44 @@ void Renderer::clear()
     m_api->clear();
 }
 
+void Renderer::setViewport(int32_t x, int32_t y, int32_t width, int32_t height)
+{
+    if (!m_api)
+    {
+        LOG_WARN("WARN::API::NOT_INITIALIZED");
+        return;
+    }
+
+    m_api->setViewport(x, y, width, height);
+}
+
+void Renderer::beginScene()
+{
+    m_queue.clear();
+}
+
+void Renderer::beginScene(const FrameUniforms& frame)
+{
+    m_queue.clear();
+    if (!m_uniforms) return;
+
+    UniformAllocation allocation = m_uniforms->allocate(&frame, sizeof(frame));
+    m_uniforms->bind_range(static_cast<uint32_t>(UniformBinding::Frame), allocation);
+}
+
+void Renderer::submit(const RenderPacket& packet)
+{
+    m_queue.submit(packet);
+}
+
+void Renderer::endScene()
+{
+    if (!m_api)
+    {
+        LOG_WARN("WARN::API::NOT_INITIALIZED");
+        m_queue.clear();
+        return;
+    }
+
+    m_queue.execute(*m_api, m_uniforms.get());
+}
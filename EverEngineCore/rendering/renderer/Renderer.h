@@ -1,13 +1,62 @@
 #pragma once
 #include <memory>
+#include <glm/glm.hpp>
 #include "EverEngineCore/rendering/renderer/API/RendererAPI.h"
+#include "EverEngineCore/rendering/renderer/RenderQueue.h"
+#include "EverEngineCore/rendering/buffers/UniformBuffer.h"
+
+/**
+ * @brief Дані кадру, спільні для всіх шейдерів (розкладка std140).
+ *
+ * @code
+ * layout(std140) uniform FrameData
+ * {
+ *     mat4 u_View;
+ *     mat4 u_Projection;
+ *     mat4 u_ViewProjection;
+ *     vec4 u_CameraPosition;   // w - час у секундах
+ *     vec4 u_LightDirection;
+ *     vec4 u_LightColor;       // w - інтенсивність
+ *     vec4 u_AmbientColor;
+ * };
+ * @endcode
+ */
+struct FrameUniforms
+{
+    glm::mat4 view{ 1.0f };
+    glm::mat4 projection{ 1.0f };
+    glm::mat4 viewProjection{ 1.0f };
+    glm::vec4 cameraPosition{ 0.0f };
+    glm::vec4 lightDirection{ 0.0f, -1.0f, 0.0f, 0.0f };
+    glm::vec4 lightColor{ 1.0f };
+    glm::vec4 ambientColor{ 0.1f, 0.1f, 0.1f, 1.0f };
+};
 
 class Renderer
 {
 public:
     static int init(void*(*loader)(const char*), APIType api = APIType::OpenGL);
+    /// Звільняє ресурси GL; викликається до знищення контексту.
+    static void shutdown();
     static void setClearColor(float r, float g, float b, float a);
     static void clear();
+    static void setViewport(int32_t x, int32_t y, int32_t width, int32_t height);
+
+    /// Починає кадр черги малювання (відкидає невиконані пакети).
+    static void beginScene();
+    /// Те саме, але ще й заливає дані кадру в блок FrameData один раз на кадр.
+    static void beginScene(const FrameUniforms& frame);
+    /// Додає пакет; малювання відкладається до endScene().
+    static void submit(const RenderPacket& packet);
+    /// Сортує пакети за ключами та виконує їх.
+    static void endScene();
+
+    static const RenderQueueStats& getStats() { return m_queue.getStats(); }
+
+    /// Бекенд для підсистем рендерингу (Renderer2D тощо); nullptr до init().
+    static RendererAPI* getAPI() { return m_api.get(); }
 private:
     static std::unique_ptr<RendererAPI> m_api;    
+    static RenderQueue m_queue;
+    static std::shared_ptr<UniformBuffer> m_uniforms;   ///< Кільце блоків кадру, матеріалів та об'єктів
 };
\ No newline at end of file
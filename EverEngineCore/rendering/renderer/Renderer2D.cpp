@@ -0,0 +1,322 @@
+#include "EverEngineCore/rendering/renderer/Renderer2D.h"
+#include "EverEngineCore/rendering/renderer/Renderer.h"
+#include "EverEngineCore/rendering/buffers/VertexArray.h"
+#include "EverEngineCore/rendering/shader/Shader.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace
+{
+    /// Мінімум, який гарантує кожна реалізація GL 3.3 для фрагментного шейдера.
+    constexpr uint32_t k_maxTextureSlots = 16;
+
+    constexpr UniformId k_viewProjection("u_ViewProjection");
+    constexpr UniformId k_textures("u_Textures");
+
+    struct QuadVertex
+    {
+        float position[3];
+        float color[4];
+        float uv[2];
+        float textureSlot;
+    };
+
+    constexpr const char* k_vertexSource = R"(
+#version 330 core
+layout(location = 0) in vec3 a_Position;
+layout(location = 1) in vec4 a_Color;
+layout(location = 2) in vec2 a_TexCoord;
+layout(location = 3) in float a_TexSlot;
+
+uniform mat4 u_ViewProjection;
+
+out vec4 v_Color;
+out vec2 v_TexCoord;
+flat out int v_TexSlot;
+
+void main()
+{
+    v_Color = a_Color;
+    v_TexCoord = a_TexCoord;
+    v_TexSlot = int(a_TexSlot);
+    gl_Position = u_ViewProjection * vec4(a_Position, 1.0);
+}
+)";
+
+    // Індексувати масив семплерів змінною GLSL 3.30 не дозволяє, тому switch
+    constexpr const char* k_fragmentSource = R"(
+#version 330 core
+in vec4 v_Color;
+in vec2 v_TexCoord;
+flat in int v_TexSlot;
+
+uniform sampler2D u_Textures[16];
+
+out vec4 o_Color;
+
+void main()
+{
+    vec4 texel;
+    switch (v_TexSlot)
+    {
+    case 0:  texel = texture(u_Textures[0],  v_TexCoord); break;
+    case 1:  texel = texture(u_Textures[1],  v_TexCoord); break;
+    case 2:  texel = texture(u_Textures[2],  v_TexCoord); break;
+    case 3:  texel = texture(u_Textures[3],  v_TexCoord); break;
+    case 4:  texel = texture(u_Textures[4],  v_TexCoord); break;
+    case 5:  texel = texture(u_Textures[5],  v_TexCoord); break;
+    case 6:  texel = texture(u_Textures[6],  v_TexCoord); break;
+    case 7:  texel = texture(u_Textures[7],  v_TexCoord); break;
+    case 8:  texel = texture(u_Textures[8],  v_TexCoord); break;
+    case 9:  texel = texture(u_Textures[9],  v_TexCoord); break;
+    case 10: texel = texture(u_Textures[10], v_TexCoord); break;
+    case 11: texel = texture(u_Textures[11], v_TexCoord); break;
+    case 12: texel = texture(u_Textures[12], v_TexCoord); break;
+    case 13: texel = texture(u_Textures[13], v_TexCoord); break;
+    case 14: texel = texture(u_Textures[14], v_TexCoord); break;
+    default: texel = texture(u_Textures[15], v_TexCoord); break;
+    }
+    o_Color = texel * v_Color;
+}
+)";
+
+    struct Renderer2DData
+    {
+        uint32_t maxQuads = 0;
+        std::shared_ptr<VertexArray> vertexArray;
+        std::shared_ptr<VertexBuffer> vertexBuffer;
+        std::shared_ptr<IndexBuffer> indexBuffer;
+        std::shared_ptr<Shader> shader;
+        UniformHandle viewProjection;
+        uint32_t whiteTexture = 0;
+
+        std::vector<QuadVertex> vertices;
+        std::array<uint32_t, k_maxTextureSlots> textureSlots{};
+        uint32_t textureSlotCount = 1;  ///< Слот 0 завжди біла текстура
+
+        Renderer2DStats stats;
+    };
+
+    std::unique_ptr<Renderer2DData> s_data;
+
+    void flush()
+    {
+        RendererAPI* api = Renderer::getAPI();
+        if (s_data->vertices.empty() || !api) return;
+
+        // Потоковий буфер кладе кожен пакет у нову ділянку кільця, не чекаючи на попередній виклик
+        size_t bytes = s_data->vertices.size() * sizeof(QuadVertex);
+        s_data->vertexBuffer->set_data(s_data->vertices.data(), bytes);
+
+        for (uint32_t slot = 0; slot < s_data->textureSlotCount; slot++)
+        {
+            api->bindTexture(slot, s_data->textureSlots[slot]);
+        }
+
+        api->setBlending(true);
+        s_data->shader->bind();
+        s_data->vertexArray->bind();
+        uint32_t quadCount = static_cast<uint32_t>(s_data->vertices.size() / 4);
+        api->drawIndexed(*s_data->vertexArray, quadCount * 6, DrawMode::Triangles);
+
+        s_data->stats.drawCalls++;
+        s_data->vertices.clear();
+        s_data->textureSlotCount = 1;
+    }
+
+    /// Повертає слот текстури в поточному пакеті, скидаючи пакет, якщо слоти закінчились.
+    float texture_slot(uint32_t texture)
+    {
+        if (texture == 0 || texture == s_data->whiteTexture) return 0.0f;
+
+        for (uint32_t slot = 1; slot < s_data->textureSlotCount; slot++)
+        {
+            if (s_data->textureSlots[slot] == texture) return static_cast<float>(slot);
+        }
+
+        if (s_data->textureSlotCount == k_maxTextureSlots) flush();
+
+        uint32_t slot = s_data->textureSlotCount++;
+        s_data->textureSlots[slot] = texture;
+        return static_cast<float>(slot);
+    }
+
+    /// Додає прямокутник за чотирма кутами (проти годинникової стрілки від лівого нижнього).
+    void push_quad(const std::array<glm::vec3, 4>& corners, uint32_t texture,
+        const glm::vec2& uvMin, const glm::vec2& uvMax, const glm::vec4& color)
+    {
+        if (!s_data) return;
+        if (s_data->vertices.size() >= static_cast<size_t>(s_data->maxQuads) * 4) flush();
+
+        // Слот визначається після можливого скидання, інакше він вказував би на старий пакет
+        float slot = texture_slot(texture);
+        const float uvs[4][2] = {
+            { uvMin.x, uvMin.y }, { uvMax.x, uvMin.y }, { uvMax.x, uvMax.y }, { uvMin.x, uvMax.y }
+        };
+
+        for (size_t i = 0; i < 4; i++)
+        {
+            s_data->vertices.push_back({
+                { corners[i].x, corners[i].y, corners[i].z },
+                { color.x, color.y, color.z, color.w },
+                { uvs[i][0], uvs[i][1] },
+                slot
+            });
+        }
+        s_data->stats.quadCount++;
+    }
+
+    std::array<glm::vec3, 4> axis_aligned_corners(const glm::vec3& position, const glm::vec2& size)
+    {
+        float hx = size.x * 0.5f;
+        float hy = size.y * 0.5f;
+        return {{
+            { position.x - hx, position.y - hy, position.z },
+            { position.x + hx, position.y - hy, position.z },
+            { position.x + hx, position.y + hy, position.z },
+            { position.x - hx, position.y + hy, position.z }
+        }};
+    }
+}
+
+bool Renderer2D::init(uint32_t maxQuads, uint32_t maxBatchesPerFrame)
+{
+    RendererAPI* api = Renderer::getAPI();
+    if (!api)
+    {
+        LOG_ERROR("ERROR::RENDERER2D::API_NOT_INITIALIZED");
+        return false;
+    }
+
+    auto data = std::make_unique<Renderer2DData>();
+    // Індекси 32-бітні, але обмежимо пакет розумним розміром
+    data->maxQuads = std::clamp<uint32_t>(maxQuads, 1, 1u << 20);
+    data->vertices.reserve(static_cast<size_t>(data->maxQuads) * 4);
+
+    std::vector<unsigned int> indices(static_cast<size_t>(data->maxQuads) * 6);
+    for (uint32_t quad = 0, vertex = 0; quad < data->maxQuads; quad++, vertex += 4)
+    {
+        unsigned int* index = &indices[static_cast<size_t>(quad) * 6];
+        index[0] = vertex + 0; index[1] = vertex + 1; index[2] = vertex + 2;
+        index[3] = vertex + 2; index[4] = vertex + 3; index[5] = vertex + 0;
+    }
+
+    // Частина кільця - бюджет кадру, а не одного пакета: інакше кожен повний пакет
+    // перемикав би частину й чекав на паркан пакета, надісланого двома пакетами раніше
+    size_t batchBytes = static_cast<size_t>(data->maxQuads) * 4 * sizeof(QuadVertex);
+    size_t frameBytes = batchBytes * std::max<uint32_t>(maxBatchesPerFrame, 1);
+    data->vertexBuffer = VertexBuffer::create(static_cast<uint32_t>(std::min<size_t>(frameBytes, UINT32_MAX)),
+        BufferUsage::Stream);
+    data->indexBuffer = IndexBuffer::create(indices.data(), indices.size());
+    data->vertexArray = VertexArray::create();
+    data->vertexArray->add_vertex_buffer(data->vertexBuffer, {
+        { ShaderDataType::Float3, "a_Position" },
+        { ShaderDataType::Float4, "a_Color" },
+        { ShaderDataType::Float2, "a_TexCoord" },
+        { ShaderDataType::Float,  "a_TexSlot" }
+    });
+    data->vertexArray->set_index_buffer(data->indexBuffer);
+
+    data->shader = Shader::create_from_source("Renderer2D", {
+        { ShaderStageType::Vertex, k_vertexSource },
+        { ShaderStageType::Fragment, k_fragmentSource }
+    });
+    if (!data->shader->is_valid())
+    {
+        LOG_ERROR("ERROR::RENDERER2D::SHADER");
+        return false;
+    }
+
+    const uint32_t white = 0xFFFFFFFF;
+    data->whiteTexture = api->createTexture(1, 1, &white);
+    data->textureSlots[0] = data->whiteTexture;
+
+    int samplers[k_maxTextureSlots];
+    for (uint32_t i = 0; i < k_maxTextureSlots; i++) samplers[i] = static_cast<int>(i);
+    data->viewProjection = data->shader->get_uniform_handle(k_viewProjection);
+    data->shader->bind();
+    data->shader->set_int_array(data->shader->get_uniform_handle(k_textures), samplers, k_maxTextureSlots);
+
+    s_data = std::move(data);
+    LOG_INFO("RENDERER2D::INIT (max quads per batch: {})", s_data->maxQuads);
+    return true;
+}
+
+void Renderer2D::shutdown()
+{
+    if (!s_data) return;
+
+    if (RendererAPI* api = Renderer::getAPI()) api->deleteTexture(s_data->whiteTexture);
+    s_data.reset();
+}
+
+void Renderer2D::beginBatch(const glm::mat4& viewProjection)
+{
+    if (!s_data) return;
+
+    s_data->vertexBuffer->begin_frame();
+    s_data->shader->bind();
+    s_data->shader->set_mat4(s_data->viewProjection, &viewProjection[0][0]);
+    s_data->vertices.clear();
+    s_data->textureSlotCount = 1;
+}
+
+void Renderer2D::endBatch()
+{
+    if (!s_data) return;
+    flush();
+
+    if (RendererAPI* api = Renderer::getAPI()) api->setBlending(false);
+}
+
+void Renderer2D::drawQuad(const glm::vec3& position, const glm::vec2& size, const glm::vec4& color)
+{
+    push_quad(axis_aligned_corners(position, size), 0, { 0.0f, 0.0f }, { 1.0f, 1.0f }, color);
+}
+
+void Renderer2D::drawQuad(const glm::vec3& position, const glm::vec2& size, uint32_t texture, const glm::vec4& tint)
+{
+    push_quad(axis_aligned_corners(position, size), texture, { 0.0f, 0.0f }, { 1.0f, 1.0f }, tint);
+}
+
+void Renderer2D::drawQuad(const glm::vec3& position, const glm::vec2& size, uint32_t texture,
+    const glm::vec2& uvMin, const glm::vec2& uvMax, const glm::vec4& tint)
+{
+    push_quad(axis_aligned_corners(position, size), texture, uvMin, uvMax, tint);
+}
+
+void Renderer2D::drawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float rotation,
+    uint32_t texture, const glm::vec4& tint)
+{
+    float c = std::cos(rotation);
+    float s = std::sin(rotation);
+    float hx = size.x * 0.5f;
+    float hy = size.y * 0.5f;
+
+    std::array<glm::vec3, 4> corners;
+    const float local[4][2] = { { -hx, -hy }, { hx, -hy }, { hx, hy }, { -hx, hy } };
+    for (size_t i = 0; i < 4; i++)
+    {
+        corners[i] = {
+            position.x + local[i][0] * c - local[i][1] * s,
+            position.y + local[i][0] * s + local[i][1] * c,
+            position.z
+        };
+    }
+    push_quad(corners, texture, { 0.0f, 0.0f }, { 1.0f, 1.0f }, tint);
+}
+
+const Renderer2DStats& Renderer2D::getStats()
+{
+    static const Renderer2DStats empty;
+    return s_data ? s_data->stats : empty;
+}
+
+void Renderer2D::resetStats()
+{
+    if (s_data) s_data->stats = {};
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstdint>
+#include <glm/glm.hpp>
+
+/**
+ * @brief Статистика Renderer2D за поточний кадр.
+ */
+struct Renderer2DStats
+{
+    uint32_t drawCalls = 0;
+    uint32_t quadCount = 0;
+};
+
+/**
+ * @brief Пакетний рендерер прямокутників та спрайтів.
+ *
+ * Вершини прямокутників (позиція, колір, UV, слот текстури) накопичуються
+ * на CPU і надсилаються одним викликом малювання на пакет. Пакет
+ * скидається, коли заповнено maxQuads прямокутників або всі слоти текстур,
+ * а також в endBatch(). Індекси для всіх прямокутників обчислюються один
+ * раз у init() і спільні для всіх пакетів, а вершинний буфер потоковий
+ * (BufferUsage::Stream): кожен пакет пишеться в нову ділянку кільцевого
+ * буфера, тож драйвер не чекає на попередній виклик малювання. Частина
+ * кільця вміщає maxBatchesPerFrame пакетів і змінюється раз на кадр у
+ * beginBatch(), тож CPU чекає лише на кадр, надісланий три кадри тому.
+ *
+ * Текстури задаються ідентифікаторами RendererAPI::createTexture; 0 означає
+ * білу текстуру (лише колір).
+ *
+ * @code
+ * Renderer2D::beginBatch(viewProjection);
+ * for (const auto& sprite : sprites)
+ *     Renderer2D::drawQuad(sprite.position, sprite.size, sprite.texture);
+ * Renderer2D::endBatch();
+ * @endcode
+ */
+class Renderer2D
+{
+public:
+    /**
+     * @brief Створює буфери, білу текстуру та шейдер. Потребує Renderer::init.
+     * @param maxQuads Кількість прямокутників в одному пакеті.
+     * @param maxBatchesPerFrame Скільки повних пакетів кадру вміщає частина кільця;
+     *        більші кадри працюють, але можуть чекати на GPU посеред кадру.
+     * @return true, якщо рендерер готовий.
+     */
+    static bool init(uint32_t maxQuads = 20000, uint32_t maxBatchesPerFrame = 3);
+
+    /// Викликається з Renderer::shutdown(); без init() нічого не робить.
+    static void shutdown();
+
+    /**
+     * @brief Починає кадр.
+     * @param viewProjection Матриця камери.
+     */
+    static void beginBatch(const glm::mat4& viewProjection);
+
+    /**
+     * @brief Надсилає накопичені прямокутники.
+     */
+    static void endBatch();
+
+    /// Позиція - центр прямокутника.
+    static void drawQuad(const glm::vec3& position, const glm::vec2& size, const glm::vec4& color);
+    static void drawQuad(const glm::vec3& position, const glm::vec2& size, uint32_t texture,
+        const glm::vec4& tint = { 1.0f, 1.0f, 1.0f, 1.0f });
+
+    /**
+     * @brief Малює прямокутник з частиною текстури (кадр атласу).
+     * @param uvMin Лівий нижній кут у текстурних координатах.
+     * @param uvMax Правий верхній кут у текстурних координатах.
+     */
+    static void drawQuad(const glm::vec3& position, const glm::vec2& size, uint32_t texture,
+        const glm::vec2& uvMin, const glm::vec2& uvMax, const glm::vec4& tint = { 1.0f, 1.0f, 1.0f, 1.0f });
+
+    /**
+     * @brief Малює прямокутник, повернутий навколо центру.
+     * @param rotation Кут у радіанах.
+     */
+    static void drawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float rotation,
+        uint32_t texture, const glm::vec4& tint = { 1.0f, 1.0f, 1.0f, 1.0f });
+
+    static const Renderer2DStats& getStats();
+    static void resetStats();
+};
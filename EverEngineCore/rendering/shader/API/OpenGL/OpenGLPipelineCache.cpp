@@ -0,0 +1,91 @@
+#include "EverEngineCore/rendering/shader/API/OpenGL/OpenGLPipelineCache.h"
+#include "EverEngineCore/rendering/shader/API/OpenGL/OpenGLStageProgram.h"
+#include "EverEngineCore/rendering/renderer/API/OpenGL/OpenGLState.h"
+#include "EverEngineCore/core/Hash.h"
+#include "EverEngineCore/core/Log.h"
+
+#include <array>
+#include <unordered_map>
+
+namespace
+{
+    constexpr size_t k_stageCount = 6;
+
+    /// Програма на кожен тип стадії (індекс - ShaderStageType), 0 - стадії немає.
+    using PipelineKey = std::array<GLuint, k_stageCount>;
+
+    struct PipelineKeyHash
+    {
+        size_t operator()(const PipelineKey& key) const
+        {
+            uint64_t hash = 0;
+            for (GLuint program : key) hash = Hash::combine(hash, program);
+            return static_cast<size_t>(hash);
+        }
+    };
+
+    std::unordered_map<PipelineKey, GLuint, PipelineKeyHash> s_pipelines;
+}
+
+GLuint OpenGLPipelineCache::get(const std::vector<const OpenGLStageProgram*>& stages)
+{
+    PipelineKey key{};
+    for (const OpenGLStageProgram* stage : stages)
+    {
+        if (!stage || !stage->is_valid()) return 0;
+
+        GLuint& slot = key[static_cast<size_t>(stage->get_stage())];
+        if (slot != 0)
+        {
+            LOG_ERROR("ERROR::PIPELINE::DUPLICATE_STAGE '{}'", stage->get_name());
+            return 0;
+        }
+        slot = stage->get_id();
+    }
+
+    auto it = s_pipelines.find(key);
+    if (it != s_pipelines.end()) return it->second;
+
+    GLuint pipeline = 0;
+    glGenProgramPipelines(1, &pipeline);
+    for (const OpenGLStageProgram* stage : stages)
+    {
+        glUseProgramStages(pipeline, stage->get_stage_bit(), stage->get_id());
+    }
+
+    s_pipelines.emplace(key, pipeline);
+    return pipeline;
+}
+
+void OpenGLPipelineCache::onStageDeleted(GLuint program)
+{
+    for (auto it = s_pipelines.begin(); it != s_pipelines.end();)
+    {
+        bool uses = false;
+        for (GLuint stage : it->first) uses |= stage == program;
+
+        if (!uses)
+        {
+            ++it;
+            continue;
+        }
+        OpenGLState::onProgramPipelineDeleted(it->second);
+        glDeleteProgramPipelines(1, &it->second);
+        it = s_pipelines.erase(it);
+    }
+}
+
+void OpenGLPipelineCache::clear()
+{
+    for (auto& [key, pipeline] : s_pipelines)
+    {
+        OpenGLState::onProgramPipelineDeleted(pipeline);
+        glDeleteProgramPipelines(1, &pipeline);
+    }
+    s_pipelines.clear();
+}
+
+size_t OpenGLPipelineCache::size()
+{
+    return s_pipelines.size();
+}
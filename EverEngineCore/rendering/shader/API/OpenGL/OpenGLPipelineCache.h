@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include <glad/glad.h>
+
+class OpenGLStageProgram;
+
+/**
+ * @brief Кеш об'єктів конвеєра програм (glGenProgramPipelines) за набором стадій.
+ *
+ * Однаковий набір окремих програм стадій завжди дає той самий конвеєр.
+ * Створення конвеєра не лінкує код, тож комбінація стадій коштує
+ * кілька викликів glUseProgramStages. Конвеєри, що посилаються на
+ * видалену стадію, видаляються разом із нею.
+ */
+class OpenGLPipelineCache
+{
+public:
+    /**
+     * @brief Повертає конвеєр для стадій, створюючи його при першому запиті.
+     * @return 0, якщо стадія недійсна або дві стадії одного типу.
+     */
+    static GLuint get(const std::vector<const OpenGLStageProgram*>& stages);
+
+    static void onStageDeleted(GLuint program);
+
+    /**
+     * @brief Видаляє всі конвеєри; викликається до знищення контексту.
+     */
+    static void clear();
+
+    static size_t size();
+};
@@ -0,0 +1,183 @@
+#include "EverEngineCore/rendering/shader/API/OpenGL/OpenGLPipelineShader.h"
+#include "EverEngineCore/rendering/shader/API/OpenGL/OpenGLPipelineCache.h"
+#include "EverEngineCore/rendering/renderer/API/OpenGL/OpenGLState.h"
+#include "EverEngineCore/core/Log.h"
+
+#include <algorithm>
+#include <utility>
+
+OpenGLPipelineShader::OpenGLPipelineShader(const std::string& name, std::vector<std::shared_ptr<ShaderStageProgram>> stages)
+    : m_name(name), m_stages(std::move(stages))
+{
+    for (const auto& stage : m_stages)
+    {
+        auto* program = dynamic_cast<const OpenGLStageProgram*>(stage.get());
+        if (!program || !program->is_valid())
+        {
+            LOG_ERROR("ERROR::PIPELINE_SHADER::INVALID_STAGE '{}'", m_name);
+            m_programs.clear();
+            return;
+        }
+        m_programs.push_back(program);
+    }
+
+    m_pipeline = OpenGLPipelineCache::get(m_programs);
+    if (m_pipeline != 0) LOG_INFO("Shader '{}' composed from {} stages (pipeline: {})", m_name, m_programs.size(), m_pipeline);
+}
+
+void OpenGLPipelineShader::bind() const
+{
+    OpenGLState::bindProgramPipeline(m_pipeline);
+}
+
+void OpenGLPipelineShader::unbind() const
+{
+    OpenGLState::bindProgramPipeline(0);
+}
+
+void OpenGLPipelineShader::set_bool(const std::string& name, bool value)
+{
+    for_each_location(name, [&](GLuint program, GLint location) { glProgramUniform1i(program, location, value ? 1 : 0); });
+}
+
+void OpenGLPipelineShader::set_int(const std::string& name, int value)
+{
+    for_each_location(name, [&](GLuint program, GLint location) { glProgramUniform1i(program, location, value); });
+}
+
+void OpenGLPipelineShader::set_int_array(const std::string& name, int* values, uint32_t count)
+{
+    for_each_location(name, [&](GLuint program, GLint location) { glProgramUniform1iv(program, location, count, values); });
+}
+
+void OpenGLPipelineShader::set_float(const std::string& name, float value)
+{
+    for_each_location(name, [&](GLuint program, GLint location) { glProgramUniform1f(program, location, value); });
+}
+
+void OpenGLPipelineShader::set_float2(const std::string& name, float x, float y)
+{
+    for_each_location(name, [&](GLuint program, GLint location) { glProgramUniform2f(program, location, x, y); });
+}
+
+void OpenGLPipelineShader::set_float3(const std::string& name, float x, float y, float z)
+{
+    for_each_location(name, [&](GLuint program, GLint location) { glProgramUniform3f(program, location, x, y, z); });
+}
+
+void OpenGLPipelineShader::set_float4(const std::string& name, float x, float y, float z, float w)
+{
+    for_each_location(name, [&](GLuint program, GLint location) { glProgramUniform4f(program, location, x, y, z, w); });
+}
+
+void OpenGLPipelineShader::set_mat2(const std::string& name, const float* value)
+{
+    for_each_location(name, [&](GLuint program, GLint location) { glProgramUniformMatrix2fv(program, location, 1, GL_FALSE, value); });
+}
+
+void OpenGLPipelineShader::set_mat3(const std::string& name, const float* value)
+{
+    for_each_location(name, [&](GLuint program, GLint location) { glProgramUniformMatrix3fv(program, location, 1, GL_FALSE, value); });
+}
+
+void OpenGLPipelineShader::set_mat4(const std::string& name, const float* value)
+{
+    for_each_location(name, [&](GLuint program, GLint location) { glProgramUniformMatrix4fv(program, location, 1, GL_FALSE, value); });
+}
+
+UniformHandle OpenGLPipelineShader::get_uniform_handle(UniformId id) const
+{
+    for (size_t i = 0; i < m_handleHashes.size(); i++)
+    {
+        if (m_handleHashes[i] == id.hash) return { static_cast<uint32_t>(i) };
+    }
+
+    bool found = false;
+    m_handleHashes.push_back(id.hash);
+    for (const OpenGLStageProgram* program : m_programs)
+    {
+        GLint location = program->find_location(id.hash);
+        found |= location != -1;
+        m_handleLocations.push_back(location);
+    }
+
+    if (!found && m_pipeline != 0)
+        LOG_WARN("Uniform with hash {:#010x} not found in shader '{}'", id.hash, m_name);
+    return { static_cast<uint32_t>(m_handleHashes.size() - 1) };
+}
+
+void OpenGLPipelineShader::set_int(UniformHandle handle, int value)
+{
+    for_each_location(handle, [&](GLuint program, GLint location) { glProgramUniform1i(program, location, value); });
+}
+
+void OpenGLPipelineShader::set_int_array(UniformHandle handle, const int* values, uint32_t count)
+{
+    for_each_location(handle, [&](GLuint program, GLint location) { glProgramUniform1iv(program, location, count, values); });
+}
+
+void OpenGLPipelineShader::set_float(UniformHandle handle, float value)
+{
+    for_each_location(handle, [&](GLuint program, GLint location) { glProgramUniform1f(program, location, value); });
+}
+
+void OpenGLPipelineShader::set_float2(UniformHandle handle, float x, float y)
+{
+    for_each_location(handle, [&](GLuint program, GLint location) { glProgramUniform2f(program, location, x, y); });
+}
+
+void OpenGLPipelineShader::set_float3(UniformHandle handle, float x, float y, float z)
+{
+    for_each_location(handle, [&](GLuint program, GLint location) { glProgramUniform3f(program, location, x, y, z); });
+}
+
+void OpenGLPipelineShader::set_float4(UniformHandle handle, float x, float y, float z, float w)
+{
+    for_each_location(handle, [&](GLuint program, GLint location) { glProgramUniform4f(program, location, x, y, z, w); });
+}
+
+void OpenGLPipelineShader::set_mat3(UniformHandle handle, const float* value)
+{
+    for_each_location(handle, [&](GLuint program, GLint location) { glProgramUniformMatrix3fv(program, location, 1, GL_FALSE, value); });
+}
+
+void OpenGLPipelineShader::set_mat4(UniformHandle handle, const float* value)
+{
+    for_each_location(handle, [&](GLuint program, GLint location) { glProgramUniformMatrix4fv(program, location, 1, GL_FALSE, value); });
+}
+
+std::vector<std::string> OpenGLPipelineShader::get_uniform_names() const
+{
+    std::vector<std::string> names;
+    for (const OpenGLStageProgram* program : m_programs)
+    {
+        for (const auto& [name, location] : program->get_uniforms())
+        {
+            if (std::find(names.begin(), names.end(), name) == names.end()) names.push_back(name);
+        }
+    }
+    return names;
+}
+
+std::string OpenGLPipelineShader::get_uniform_type(const std::string& name) const
+{
+    for (const OpenGLStageProgram* program : m_programs)
+    {
+        switch (program->find_type(name))
+        {
+            case 0: continue;
+            case GL_FLOAT: return "float";
+            case GL_FLOAT_VEC2: return "vec2";
+            case GL_FLOAT_VEC3: return "vec3";
+            case GL_FLOAT_VEC4: return "vec4";
+            case GL_INT: return "int";
+            case GL_BOOL: return "bool";
+            case GL_FLOAT_MAT2: return "mat2";
+            case GL_FLOAT_MAT3: return "mat3";
+            case GL_FLOAT_MAT4: return "mat4";
+            case GL_SAMPLER_2D: return "sampler2D";
+            default: return "unknown";
+        }
+    }
+    return "unknown";
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <glad/glad.h>
+
+#include "EverEngineCore/rendering/shader/Shader.h"
+#include "EverEngineCore/rendering/shader/API/OpenGL/OpenGLStageProgram.h"
+
+/**
+ * @brief Шейдер, складений з окремих програм стадій через конвеєр програм.
+ *
+ * Uniform-змінні встановлюються glProgramUniform* у кожну стадію, що їх
+ * містить, тому прив'язка шейдера для цього не потрібна.
+ */
+class OpenGLPipelineShader : public Shader
+{
+public:
+    OpenGLPipelineShader(const std::string& name, std::vector<std::shared_ptr<ShaderStageProgram>> stages);
+
+    void bind() const override;
+    void unbind() const override;
+
+    bool is_valid() const override { return m_pipeline != 0; }
+    uint32_t get_id() const override { return m_pipeline; }
+    const std::string& get_name() const override { return m_name; }
+
+    /// Стадії перезбираються окремо; складений шейдер перезавантаження не підтримує.
+    bool reload() override { return false; }
+    ShaderStatus get_status() override { return m_pipeline != 0 ? ShaderStatus::Ready : ShaderStatus::Failed; }
+    bool wait() override { return m_pipeline != 0; }
+
+    void set_bool(const std::string& name, bool value) override;
+    void set_int(const std::string& name, int value) override;
+    void set_int_array(const std::string& name, int* values, uint32_t count) override;
+
+    void set_float(const std::string& name, float value) override;
+    void set_float2(const std::string& name, float x, float y) override;
+    void set_float3(const std::string& name, float x, float y, float z) override;
+    void set_float4(const std::string& name, float x, float y, float z, float w) override;
+
+    void set_mat2(const std::string& name, const float* value) override;
+    void set_mat3(const std::string& name, const float* value) override;
+    void set_mat4(const std::string& name, const float* value) override;
+
+    UniformHandle get_uniform_handle(UniformId id) const override;
+
+    void set_int(UniformHandle handle, int value) override;
+    void set_int_array(UniformHandle handle, const int* values, uint32_t count) override;
+    void set_float(UniformHandle handle, float value) override;
+    void set_float2(UniformHandle handle, float x, float y) override;
+    void set_float3(UniformHandle handle, float x, float y, float z) override;
+    void set_float4(UniformHandle handle, float x, float y, float z, float w) override;
+    void set_mat3(UniformHandle handle, const float* value) override;
+    void set_mat4(UniformHandle handle, const float* value) override;
+
+    std::vector<std::string> get_uniform_names() const override;
+    std::string get_uniform_type(const std::string& name) const override;
+private:
+    std::string m_name;
+    std::vector<std::shared_ptr<ShaderStageProgram>> m_stages;  ///< Тримають програми стадій живими
+    std::vector<const OpenGLStageProgram*> m_programs;
+    GLuint m_pipeline = 0;
+
+    mutable std::vector<uint32_t> m_handleHashes;
+    mutable std::vector<GLint> m_handleLocations;   ///< m_programs.size() розташувань на дескриптор
+
+    /// Викликає set(program, location) для кожної стадії, що має змінну.
+    template<typename Setter>
+    void for_each_location(const std::string& name, Setter&& set) const
+    {
+        for (const OpenGLStageProgram* program : m_programs)
+        {
+            GLint location = program->find_location(name);
+            if (location != -1) set(program->get_id(), location);
+        }
+    }
+
+    template<typename Setter>
+    void for_each_location(UniformHandle handle, Setter&& set) const
+    {
+        // Невдалий конвеєр не має програм, а m_handleLocations - розташувань
+        if (m_pipeline == 0 || m_programs.empty() || handle.index >= m_handleHashes.size()) return;
+
+        const GLint* locations = &m_handleLocations[handle.index * m_programs.size()];
+        for (size_t i = 0; i < m_programs.size(); i++)
+        {
+            if (locations[i] != -1) set(m_programs[i]->get_id(), locations[i]);
+        }
+    }
+};
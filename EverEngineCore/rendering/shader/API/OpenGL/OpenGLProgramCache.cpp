@@ -0,0 +1,136 @@
+#include "EverEngineCore/rendering/shader/API/OpenGL/OpenGLProgramCache.h"
+#include "EverEngineCore/platform/filesystem/DerivedDataCache.h"
+#include "EverEngineCore/core/Hash.h"
+#include "EverEngineCore/core/Log.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+    /// Змінюється разом із форматом запису, щоб старі записи не читались.
+    constexpr std::string_view k_salt = "GLProgramBinary v1";
+
+    struct ProgramBinaryHeader
+    {
+        char magic[4];
+        uint32_t format;        ///< GLenum формату бінарника
+        uint64_t driverHash;    ///< Хеш рядків драйвера на момент збереження
+    };
+
+    constexpr char k_magic[4] = { 'E', 'V', 'P', 'B' };
+
+    uint64_t hash_string(uint64_t seed, const GLubyte* value)
+    {
+        const char* text = value ? reinterpret_cast<const char*>(value) : "";
+        return Hash::combine(seed, Hash::xxh64(text, std::strlen(text)));
+    }
+
+    /// Хеш драйвера обчислюється один раз - рядки не змінюються протягом роботи контексту.
+    uint64_t driver_hash()
+    {
+        static const uint64_t s_hash = [] {
+            uint64_t hash = Hash::fnv1a64(k_salt);
+            hash = hash_string(hash, glGetString(GL_VENDOR));
+            hash = hash_string(hash, glGetString(GL_RENDERER));
+            hash = hash_string(hash, glGetString(GL_VERSION));
+            return hash;
+        }();
+        return s_hash;
+    }
+}
+
+bool OpenGLProgramCache::isAvailable()
+{
+    if (!GLAD_GL_VERSION_4_1 || !DerivedDataCache::isInitialized()) return false;
+
+    static const bool s_hasFormats = [] {
+        GLint formats = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+        if (formats == 0) LOG_INFO("SHADER_CACHE::NO_BINARY_FORMATS");
+        return formats > 0;
+    }();
+    return s_hasFormats;
+}
+
+uint64_t OpenGLProgramCache::makeKey(const std::unordered_map<ShaderStageType, std::string_view>& sources)
+{
+    if (!isAvailable()) return 0;
+
+    // Порядок обходу unordered_map не визначений, тож стадії впорядковуються
+    std::vector<std::pair<ShaderStageType, std::string_view>> stages(sources.begin(), sources.end());
+    std::sort(stages.begin(), stages.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    uint64_t key = driver_hash();
+    for (const auto& [stage, source] : stages)
+    {
+        key = Hash::combine(key, static_cast<uint64_t>(stage));
+        key = Hash::combine(key, Hash::xxh64(source.data(), source.size()));
+    }
+    return key != 0 ? key : 1;
+}
+
+GLuint OpenGLProgramCache::load(uint64_t key)
+{
+    if (key == 0) return 0;
+
+    std::vector<uint8_t> blob;
+    if (!DerivedDataCache::get(key, blob)) return 0;
+
+    ProgramBinaryHeader header{};
+    bool valid = blob.size() > sizeof(header);
+    if (valid)
+    {
+        std::memcpy(&header, blob.data(), sizeof(header));
+        valid = std::memcmp(header.magic, k_magic, 4) == 0 && header.driverHash == driver_hash();
+    }
+
+    if (valid)
+    {
+        GLuint program = glCreateProgram();
+        glProgramBinary(program, header.format, blob.data() + sizeof(header),
+            static_cast<GLsizei>(blob.size() - sizeof(header)));
+
+        GLint linked = GL_FALSE;
+        glGetProgramiv(program, GL_LINK_STATUS, &linked);
+        if (linked == GL_TRUE) return program;
+
+        glDeleteProgram(program);
+    }
+
+    // Драйвер може відхилити бінарник навіть з тим самим рядком версії
+    LOG_WARN("SHADER_CACHE::BINARY_REJECTED->{:016x}", key);
+    DerivedDataCache::remove(key);
+    return 0;
+}
+
+void OpenGLProgramCache::prepare(GLuint program)
+{
+    if (isAvailable()) glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+}
+
+void OpenGLProgramCache::store(uint64_t key, GLuint program)
+{
+    if (key == 0) return;
+
+    GLint length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) return;
+
+    ProgramBinaryHeader header{};
+    std::memcpy(header.magic, k_magic, 4);
+    header.driverHash = driver_hash();
+
+    std::vector<uint8_t> blob(sizeof(header) + static_cast<size_t>(length));
+    GLenum format = 0;
+    GLsizei written = 0;
+    glGetProgramBinary(program, length, &written, &format, blob.data() + sizeof(header));
+    if (written <= 0) return;
+
+    header.format = format;
+    std::memcpy(blob.data(), &header, sizeof(header));
+    blob.resize(sizeof(header) + static_cast<size_t>(written));
+
+    if (!DerivedDataCache::put(key, blob)) LOG_WARN("SHADER_CACHE::STORE_FAILED->{:016x}", key);
+}
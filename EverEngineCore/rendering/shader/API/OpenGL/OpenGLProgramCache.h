@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+#include <glad/glad.h>
+
+#include "EverEngineCore/rendering/shader/Shader.h"
+
+/**
+ * @brief Дисковий кеш бінарних програм GL (glGetProgramBinary / glProgramBinary).
+ *
+ * Ключ - XXH64 від текстів усіх стадій (разом із підставленими визначеннями)
+ * та рядків GL_VENDOR, GL_RENDERER і GL_VERSION, тож оновлення драйвера чи
+ * інша відеокарта дають новий ключ. Записи зберігаються в DerivedDataCache,
+ * який перевіряє їхню цілісність; додатково в записі зберігається формат
+ * бінарника та хеш драйвера. Якщо драйвер відхиляє бінарник, запис
+ * видаляється, а шейдер компілюється з джерел, як без кешу.
+ *
+ * Кеш вимикається сам, якщо контекст старший за GL 4.1, драйвер не
+ * підтримує жодного формату або DerivedDataCache не ініціалізовано.
+ */
+class OpenGLProgramCache
+{
+public:
+    /**
+     * @brief Чи можна зараз користуватися кешем.
+     */
+    static bool isAvailable();
+
+    /**
+     * @brief Обчислює ключ програми.
+     * @return 0, якщо кеш недоступний.
+     */
+    static uint64_t makeKey(const std::unordered_map<ShaderStageType, std::string_view>& sources);
+
+    /**
+     * @brief Створює програму з кешованого бінарника.
+     * @return Злінкована програма або 0 (немає запису чи драйвер його відхилив).
+     */
+    static GLuint load(uint64_t key);
+
+    /**
+     * @brief Готує програму до отримання бінарника; викликається перед glLinkProgram.
+     */
+    static void prepare(GLuint program);
+
+    /**
+     * @brief Зберігає бінарник щойно злінкованої програми.
+     */
+    static void store(uint64_t key, GLuint program);
+};
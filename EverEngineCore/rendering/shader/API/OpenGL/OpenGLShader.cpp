@@ -1,135 +1,403 @@
 #include "EverEngineCore/rendering/shader/API/OpenGL/OpenGLShader.h"
+#include "EverEngineCore/rendering/renderer/API/OpenGL/OpenGLState.h"
+#include "EverEngineCore/rendering/buffers/UniformBuffer.h"
+#include "EverEngineCore/rendering/shader/API/OpenGL/OpenGLProgramCache.h"
 #include "EverEngineCore/core/Log.h"
-#include "EverEngineCore/platform/filesystem/FileSystem.h"  // <- ДОДАЙ ЦЕЙ INCLUDE
+#include "EverEngineCore/rendering/shader/ShaderPreprocessor.h"
+#include "EverEngineCore/platform/filesystem/VirtualFileSystem.h"
+#include <algorithm>
+#include <cstring>
 #include <vector>
 
+namespace
+{
+    // GL_KHR_parallel_shader_compile (ARB-варіант має ті самі значення); glad завантажує лише ядро
+    constexpr GLenum k_completionStatus = 0x91B1;   ///< GL_COMPLETION_STATUS_KHR
+    using MaxShaderCompilerThreadsProc = void (APIENTRY*)(GLuint count);
+
+    bool s_parallelCompile = false;
+
+    const char* stage_name(GLenum type)
+    {
+        switch (type)
+        {
+            case GL_VERTEX_SHADER:   return "VERTEX";
+            case GL_FRAGMENT_SHADER: return "FRAGMENT";
+            case GL_GEOMETRY_SHADER: return "GEOMETRY";
+            case GL_COMPUTE_SHADER:  return "COMPUTE";
+            case GL_TESS_EVALUATION_SHADER: return "TESS_EVAL";
+            case GL_TESS_CONTROL_SHADER: return "TESS_CONTROL";
+            default: return "UNKNOWN";
+        }
+    }
+}
+
 OpenGLShader::OpenGLShader(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc)
     : m_name(name)
 {
     std::unordered_map<ShaderStageType, std::string> sources;
     sources[ShaderStageType::Vertex] = vertexSrc;
     sources[ShaderStageType::Fragment] = fragmentSrc;
-    compile_from_source(sources);
+    m_program = compile_from_source(sources);
+    if (m_program != 0) reflect_uniforms();
+    m_status = m_program != 0 ? ShaderStatus::Ready : ShaderStatus::Failed;
 }
 
 OpenGLShader::OpenGLShader(const std::string& name, const std::unordered_map<ShaderStageType, std::string>& sources)
     : m_name(name)
 {
-    compile_from_source(sources);
+    m_program = compile_from_source(sources);
+    if (m_program != 0) reflect_uniforms();
+    m_status = m_program != 0 ? ShaderStatus::Ready : ShaderStatus::Failed;
 }
 
-OpenGLShader::OpenGLShader(const std::string& name, const std::unordered_map<ShaderStageType, std::string>& filePaths, bool fromFiles)
+OpenGLShader::OpenGLShader(const std::string& name, const std::unordered_map<ShaderStageType, std::string>& filePaths, bool fromFiles, bool async)
     : m_name(name)
 {
-    if (fromFiles)
-        compile_from_files(filePaths);
+    if (fromFiles) m_filePaths = filePaths;
+
+    if (async)
+    {
+        std::vector<std::string> storage;
+        std::unordered_map<ShaderStageType, std::string_view> sources;
+        if (fromFiles)
+        {
+            if (!read_files(filePaths, storage, sources)) sources.clear();
+        }
+        else
+        {
+            for (const auto& [stage, source] : filePaths) sources[stage] = source;
+        }
+
+        m_pending = std::make_unique<PendingBuild>(submit_stages(sources));
+        m_status = ShaderStatus::Compiling;
+    }
     else
-        compile_from_source(filePaths);
+    {
+        m_program = fromFiles ? compile_from_files(filePaths) : compile_from_source(filePaths);
+        if (m_program != 0) reflect_uniforms();
+        m_status = m_program != 0 ? ShaderStatus::Ready : ShaderStatus::Failed;
+    }
+
+    if (fromFiles) watch_files();
 }
 
 OpenGLShader::~OpenGLShader()
 {
+    for (WatchId id : m_watches)
+    {
+        FileWatcher::unwatch(id);
+    }
+
+    if (m_pending)
+    {
+        for (GLuint shader : m_pending->shaders) glDeleteShader(shader);
+        if (m_pending->program != 0) glDeleteProgram(m_pending->program);
+        m_pending.reset();
+    }
+
     if (m_program != 0)
     {
+        OpenGLState::onProgramDeleted(m_program);
         glDeleteProgram(m_program);
         m_program = 0;
     }
 }
 
-void OpenGLShader::compile_from_files(const std::unordered_map<ShaderStageType, std::string>& filePaths)
+bool OpenGLShader::reload()
 {
-    std::unordered_map<ShaderStageType, std::string> sources;
+    if (m_filePaths.empty()) return false;
+    if (m_pending) complete_pending();
+
+    GLuint program = compile_from_files(m_filePaths);
+    // Новий #include міг з'явитися навіть у невдалій збірці: його виправлення теж має перезібрати шейдер
+    watch_new_includes();
+    if (program == 0)
+    {
+        LOG_ERROR("Shader '{}' reload failed, keeping previous program", m_name);
+        return false;
+    }
+
+    // Якщо стару програму зараз використовує контекст, GL видалить її після наступного glUseProgram
+    if (m_program != 0)
+    {
+        OpenGLState::onProgramDeleted(m_program);
+        glDeleteProgram(m_program);
+    }
+    m_program = program;
+
+    m_uniformLocationCache.clear();
+    m_uniformTypes.clear();
+    m_uniformsByHash.clear();
+    reflect_uniforms();
+    resolve_handles();
+    m_status = ShaderStatus::Ready;
+
+    LOG_INFO("Shader '{}' reloaded (ID: {})", m_name, m_program);
+    return true;
+}
+
+void OpenGLShader::watch_files()
+{
+    for (const auto& [stage, path] : m_filePaths) watch_file(path);
+    // Зміна підключеного файлу теж перезбирає шейдер
+    watch_new_includes();
+}
+
+void OpenGLShader::watch_new_includes()
+{
+    for (; m_watchedIncludes < m_includes.size(); m_watchedIncludes++)
+    {
+        watch_file(m_includes[m_watchedIncludes]);
+    }
+}
+
+void OpenGLShader::watch_file(const std::string& path)
+{
+    // Файли з архівів та пам'яті не мають шляху на диску
+    std::string osPath = VirtualFileSystem::resolveOSPath(path);
+    if (osPath.empty()) return;
+
+    WatchId id = FileWatcher::watch(osPath, [this](const FileEvent& event) {
+        if (event.action != FileAction::Removed) reload();
+    }, false);
+
+    if (id != 0) m_watches.push_back(id);
+}
+
+ShaderStatus OpenGLShader::get_status()
+{
+    if (m_pending && is_build_complete(*m_pending)) complete_pending();
+    return m_status;
+}
+
+bool OpenGLShader::wait()
+{
+    if (m_pending) complete_pending();
+    return m_program != 0;
+}
+
+void OpenGLShader::init_parallel_compile(void*(*loader)(const char*))
+{
+    s_parallelCompile = false;
+
+    const char* procName = nullptr;
+    GLint count = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+    for (GLint i = 0; i < count; i++)
+    {
+        const char* extension = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, static_cast<GLuint>(i)));
+        if (!extension) continue;
+
+        if (std::strcmp(extension, "GL_KHR_parallel_shader_compile") == 0)
+        {
+            procName = "glMaxShaderCompilerThreadsKHR";
+            break;
+        }
+        if (std::strcmp(extension, "GL_ARB_parallel_shader_compile") == 0)
+        {
+            procName = "glMaxShaderCompilerThreadsARB";
+        }
+    }
+
+    if (!procName)
+    {
+        LOG_INFO("SHADER::PARALLEL_COMPILE::UNSUPPORTED");
+        return;
+    }
+
+    // 0xFFFFFFFF - кількість потоків обирає драйвер
+    auto maxThreads = reinterpret_cast<MaxShaderCompilerThreadsProc>(loader(procName));
+    if (maxThreads) maxThreads(0xFFFFFFFFu);
+
+    s_parallelCompile = true;
+    LOG_INFO("SHADER::PARALLEL_COMPILE::ENABLED");
+}
+
+bool OpenGLShader::read_files(const std::unordered_map<ShaderStageType, std::string>& filePaths,
+    std::vector<std::string>& storage, std::unordered_map<ShaderStageType, std::string_view>& sources)
+{
+    // Рядки не мають переміщуватися, поки на них вказують string_view
+    storage.reserve(filePaths.size());
     
     for (const auto& [stage, path] : filePaths)
     {
-        if (!File::exists(path))
+        VirtualFile file;
+        if (!VirtualFileSystem::open(path, file))
         {
-            LOG_ERROR("Shader file not found: {}", path);
-            continue;
+            LOG_ERROR("Shader file not found or is not a file: {}", path);
+            return false;
         }
         
-        if (!File::isFile(path))
+        if (file.size() == 0)
         {
-            LOG_ERROR("Path is not a file: {}", path);
-            continue;
+            LOG_ERROR("Shader file is empty: {}", path);
+            return false;
         }
-        
-        std::string source = File::readText(path);
-        if (source.empty())
+
+        PreprocessedShader result;
+        if (!ShaderPreprocessor::process(file.text(), path, {}, result)) return false;
+
+        for (std::string& include : result.includes)
         {
-            LOG_ERROR("Failed to read shader file or file is empty: {}", path);
-            continue;
+            if (std::find(m_includes.begin(), m_includes.end(), include) == m_includes.end())
+                m_includes.push_back(std::move(include));
         }
         
-        sources[stage] = source;
+        storage.push_back(std::move(result.source));
+        sources[stage] = storage.back();
     }
-    
-    compile_from_source(sources);
+    return true;
 }
 
-void OpenGLShader::compile_from_source(const std::unordered_map<ShaderStageType, std::string>& sources)
+GLuint OpenGLShader::compile_from_files(const std::unordered_map<ShaderStageType, std::string>& filePaths)
 {
-    m_program = glCreateProgram();
-    std::vector<GLuint> shaderIDs;
+    std::vector<std::string> storage;
+    std::unordered_map<ShaderStageType, std::string_view> sources;
+    if (!read_files(filePaths, storage, sources)) return 0;
     
+    return compile_stages(sources);
+}
+
+GLuint OpenGLShader::compile_from_source(const std::unordered_map<ShaderStageType, std::string>& sources)
+{
+    std::unordered_map<ShaderStageType, std::string_view> views;
     for (const auto& [stage, source] : sources)
     {
-        GLenum glType = shader_stage_to_gl(stage);
-        GLuint shaderID = compile_shader(glType, source);
-        
-        if (shaderID != 0)
+        views[stage] = source;
+    }
+    return compile_stages(views);
+}
+
+GLuint OpenGLShader::compile_stages(const std::unordered_map<ShaderStageType, std::string_view>& sources)
+{
+    PendingBuild build = submit_stages(sources);
+    return finish_build(build);
+}
+
+OpenGLShader::PendingBuild OpenGLShader::submit_stages(const std::unordered_map<ShaderStageType, std::string_view>& sources)
+{
+    PendingBuild build;
+    if (sources.empty())
+    {
+        LOG_CRIT("No valid shaders compiled for '{}'", m_name);
+        return build;
+    }
+
+    build.cacheKey = OpenGLProgramCache::makeKey(sources);
+    if (GLuint cached = OpenGLProgramCache::load(build.cacheKey))
+    {
+        build.program = cached;
+        build.fromCache = true;
+        return build;
+    }
+
+    // Статус компіляції не запитується: запит змусив би драйвер закінчити роботу тут же.
+    // Лінкування одразу за компіляцією дозволене, помилки стадій видно в статусі програми
+    build.program = glCreateProgram();
+    for (const auto& [stage, source] : sources)
+    {
+        GLuint shader = compile_shader(shader_stage_to_gl(stage), source);
+        glAttachShader(build.program, shader);
+        build.shaders.push_back(shader);
+    }
+
+    OpenGLProgramCache::prepare(build.program);
+    glLinkProgram(build.program);
+    return build;
+}
+
+bool OpenGLShader::is_build_complete(const PendingBuild& build) const
+{
+    if (build.program == 0 || build.fromCache || !s_parallelCompile) return true;
+
+    GLint completed = GL_FALSE;
+    glGetProgramiv(build.program, k_completionStatus, &completed);
+    return completed == GL_TRUE;
+}
+
+GLuint OpenGLShader::finish_build(PendingBuild& build)
+{
+    if (build.program == 0) return 0;
+    if (build.fromCache)
+    {
+        LOG_INFO("Shader '{}' loaded from binary cache (ID: {})", m_name, build.program);
+        return build.program;
+    }
+
+    bool linked = check_compile_errors(build.program, "PROGRAM");
+    for (GLuint shader : build.shaders)
+    {
+        // Журнал стадії пояснює помилку краще за журнал лінкування
+        if (!linked)
         {
-            glAttachShader(m_program, shaderID);
-            shaderIDs.push_back(shaderID);
+            GLint type = 0;
+            glGetShaderiv(shader, GL_SHADER_TYPE, &type);
+            check_compile_errors(shader, stage_name(static_cast<GLenum>(type)));
         }
+        glDetachShader(build.program, shader);
+        glDeleteShader(shader);
     }
-    
-    if (shaderIDs.empty())
+    build.shaders.clear();
+
+    if (!linked)
     {
-        LOG_CRIT("No valid shaders compiled for '{}'", m_name);
-        glDeleteProgram(m_program);
-        m_program = 0;
+        glDeleteProgram(build.program);
+        build.program = 0;
+        return 0;
+    }
+
+    OpenGLProgramCache::store(build.cacheKey, build.program);
+    LOG_INFO("Shader '{}' compiled successfully (ID: {})", m_name, build.program);
+    return build.program;
+}
+
+void OpenGLShader::complete_pending()
+{
+    GLuint program = finish_build(*m_pending);
+    m_pending.reset();
+
+    if (program == 0)
+    {
+        m_status = m_program != 0 ? ShaderStatus::Ready : ShaderStatus::Failed;
         return;
     }
-    
-    glLinkProgram(m_program);
-    check_compile_errors(m_program, "PROGRAM");
 
-    for (GLuint id : shaderIDs)
+    if (m_program != 0)
     {
-        glDetachShader(m_program, id);
-        glDeleteShader(id);
+        OpenGLState::onProgramDeleted(m_program);
+        glDeleteProgram(m_program);
     }
+    m_program = program;
 
+    m_uniformLocationCache.clear();
+    m_uniformTypes.clear();
+    m_uniformsByHash.clear();
     reflect_uniforms();
-    
-    LOG_INFO("Shader '{}' compiled successfully (ID: {})", m_name, m_program);
+    resolve_handles();
+    m_status = ShaderStatus::Ready;
 }
 
-GLuint OpenGLShader::compile_shader(GLenum type, const std::string& source)
+void OpenGLShader::resolve_handles()
 {
-    GLuint shader = glCreateShader(type);
-    const char* src = source.c_str();
-    glShaderSource(shader, 1, &src, nullptr);
-    glCompileShader(shader);
-    
-    std::string typeStr;
-    switch (type)
+    // Видані дескриптори лишаються дійсними, оновлюються лише розташування
+    for (size_t i = 0; i < m_handleHashes.size(); i++)
     {
-        case GL_VERTEX_SHADER:   typeStr = "VERTEX"; break;
-        case GL_FRAGMENT_SHADER: typeStr = "FRAGMENT"; break;
-        case GL_GEOMETRY_SHADER: typeStr = "GEOMETRY"; break;
-        case GL_COMPUTE_SHADER:  typeStr = "COMPUTE"; break;
-        case GL_TESS_EVALUATION_SHADER: typeStr = "TESS_EVAL"; break;
-        case GL_TESS_CONTROL_SHADER: typeStr = "TESS_CONTROL"; break;
-        default: typeStr = "UNKNOWN"; break;
+        m_handleLocations[i] = find_uniform_location(m_handleHashes[i]);
     }
-    
-    check_compile_errors(shader, typeStr);
+}
+
+GLuint OpenGLShader::compile_shader(GLenum type, std::string_view source)
+{
+    GLuint shader = glCreateShader(type);
+    const char* src = source.data();
+    GLint length = static_cast<GLint>(source.size());
+    glShaderSource(shader, 1, &src, &length);
+    glCompileShader(shader);
     return shader;
 }
 
-void OpenGLShader::check_compile_errors(GLuint shader, const std::string& type)
+bool OpenGLShader::check_compile_errors(GLuint shader, const std::string& type)
 {
     GLint success;
     char infoLog[1024];
@@ -152,6 +420,7 @@ void OpenGLShader::check_compile_errors(GLuint shader, const std::string& type)
             LOG_ERROR("Program linking error: {}", infoLog);
         }
     }
+    return success != 0;
 }
 
 void OpenGLShader::reflect_uniforms()
@@ -169,19 +438,55 @@ void OpenGLShader::reflect_uniforms()
         glGetActiveUniform(m_program, i, sizeof(name), &length, &size, &type, name);
         
         GLint location = glGetUniformLocation(m_program, name);
+        // Поля uniform-блоків не мають розташування, вони задаються через UniformBuffer
+        if (location == -1) continue;
+
         m_uniformLocationCache[name] = location;
         m_uniformTypes[name] = type;
+
+        std::string_view key(name, length);
+        // Масив повертається як "u_Array[0]"; дескриптор шукається за іменем без індексу
+        if (key.size() > 3 && key.ends_with("[0]")) key.remove_suffix(3);
+
+        auto [it, inserted] = m_uniformsByHash.emplace(Hash::fnv1a32(key), location);
+        if (!inserted && it->second != location)
+        {
+            LOG_ERROR("Uniform name hash collision for '{}' in shader '{}'", key, m_name);
+        }
+    }
+
+    bind_uniform_blocks();
+}
+
+void OpenGLShader::bind_uniform_blocks()
+{
+    GLint count = 0;
+    glGetProgramiv(m_program, GL_ACTIVE_UNIFORM_BLOCKS, &count);
+
+    for (GLint i = 0; i < count; i++)
+    {
+        char name[256];
+        GLsizei length = 0;
+        glGetActiveUniformBlockName(m_program, static_cast<GLuint>(i), sizeof(name), &length, name);
+
+        uint32_t binding = 0;
+        if (!UniformBuffer::find_block_binding(std::string_view(name, length), binding))
+        {
+            LOG_WARN("Uniform block '{}' in shader '{}' has no registered binding", name, m_name);
+            continue;
+        }
+        glUniformBlockBinding(m_program, static_cast<GLuint>(i), binding);
     }
 }
 
 void OpenGLShader::bind() const
 {
-    glUseProgram(m_program);
+    OpenGLState::useProgram(m_program);
 }
 
 void OpenGLShader::unbind() const
 {
-    glUseProgram(0);
+    OpenGLState::useProgram(0);
 }
 
 GLint OpenGLShader::get_uniform_location(const std::string& name) const
@@ -198,6 +503,78 @@ GLint OpenGLShader::get_uniform_location(const std::string& name) const
     return location;
 }
 
+GLint OpenGLShader::find_uniform_location(uint32_t hash) const
+{
+    auto it = m_uniformsByHash.find(hash);
+    return it != m_uniformsByHash.end() ? it->second : -1;
+}
+
+UniformHandle OpenGLShader::get_uniform_handle(UniformId id) const
+{
+    for (size_t i = 0; i < m_handleHashes.size(); i++)
+    {
+        if (m_handleHashes[i] == id.hash) return { static_cast<uint32_t>(i) };
+    }
+
+    GLint location = find_uniform_location(id.hash);
+    if (location == -1 && m_status == ShaderStatus::Ready)
+        LOG_WARN("Uniform with hash {:#010x} not found in shader '{}'", id.hash, m_name);
+
+    m_handleHashes.push_back(id.hash);
+    m_handleLocations.push_back(location);
+    return { static_cast<uint32_t>(m_handleHashes.size() - 1) };
+}
+
+void OpenGLShader::set_int(UniformHandle handle, int value)
+{
+    glUniform1i(get_uniform_location(handle), value);
+}
+
+void OpenGLShader::set_int_array(UniformHandle handle, const int* values, uint32_t count)
+{
+    glUniform1iv(get_uniform_location(handle), count, values);
+}
+
+void OpenGLShader::set_float(UniformHandle handle, float value)
+{
+    glUniform1f(get_uniform_location(handle), value);
+}
+
+void OpenGLShader::set_float2(UniformHandle handle, float x, float y)
+{
+    glUniform2f(get_uniform_location(handle), x, y);
+}
+
+void OpenGLShader::set_float3(UniformHandle handle, float x, float y, float z)
+{
+    glUniform3f(get_uniform_location(handle), x, y, z);
+}
+
+void OpenGLShader::set_float4(UniformHandle handle, float x, float y, float z, float w)
+{
+    glUniform4f(get_uniform_location(handle), x, y, z, w);
+}
+
+void OpenGLShader::set_mat3(UniformHandle handle, const float* value)
+{
+    glUniformMatrix3fv(get_uniform_location(handle), 1, GL_FALSE, value);
+}
+
+void OpenGLShader::set_mat4(UniformHandle handle, const float* value)
+{
+    glUniformMatrix4fv(get_uniform_location(handle), 1, GL_FALSE, value);
+}
+
+void OpenGLShader::set_vec4(UniformHandle handle, const glm::vec4& value)
+{
+    set_float4(handle, value.x, value.y, value.z, value.w);
+}
+
+void OpenGLShader::set_mat4(UniformHandle handle, const glm::mat4& value)
+{
+    set_mat4(handle, &value[0][0]);
+}
+
 // Uniform setters
 void OpenGLShader::set_bool(const std::string& name, bool value)
 {
@@ -1,16 +1,19 @@
 #pragma once
 
 #include "EverEngineCore/rendering/shader/Shader.h"
+#include "EverEngineCore/platform/filesystem/FileWatcher.h"
 #include <glad/glad.h>
 #include <glm/glm.hpp>
 #include <unordered_map>
+#include <string_view>
+#include <memory>
 
 class OpenGLShader : public Shader
 {
 public:
     OpenGLShader(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc);
     OpenGLShader(const std::string& name, const std::unordered_map<ShaderStageType, std::string>& sources);
-    OpenGLShader(const std::string& name, const std::unordered_map<ShaderStageType, std::string>& filePaths, bool fromFiles);
+    OpenGLShader(const std::string& name, const std::unordered_map<ShaderStageType, std::string>& filePaths, bool fromFiles, bool async = false);
     
     virtual ~OpenGLShader();
 
@@ -21,6 +24,17 @@ public:
     uint32_t get_id() const override { return m_program; }
     const std::string& get_name() const override { return m_name; }
 
+    bool reload() override;
+    ShaderStatus get_status() override;
+    bool wait() override;
+
+    /**
+     * @brief Вмикає GL_KHR_parallel_shader_compile, якщо драйвер його підтримує.
+     *
+     * glad завантажує лише ядро GL, тому функція розширення береться через loader.
+     */
+    static void init_parallel_compile(void*(*loader)(const char*));
+
     void set_bool(const std::string& name, bool value) override;
     void set_int(const std::string& name, int value) override;
     void set_int_array(const std::string& name, int* values, uint32_t count) override;
@@ -41,22 +55,75 @@ public:
     void set_mat3(const std::string& name, const glm::mat3& value);
     void set_mat4(const std::string& name, const glm::mat4& value);
 
+    UniformHandle get_uniform_handle(UniformId id) const override;
+
+    void set_int(UniformHandle handle, int value) override;
+    void set_int_array(UniformHandle handle, const int* values, uint32_t count) override;
+    void set_float(UniformHandle handle, float value) override;
+    void set_float2(UniformHandle handle, float x, float y) override;
+    void set_float3(UniformHandle handle, float x, float y, float z) override;
+    void set_float4(UniformHandle handle, float x, float y, float z, float w) override;
+    void set_mat3(UniformHandle handle, const float* value) override;
+    void set_mat4(UniformHandle handle, const float* value) override;
+
+    void set_vec4(UniformHandle handle, const glm::vec4& value);
+    void set_mat4(UniformHandle handle, const glm::mat4& value);
+
     std::vector<std::string> get_uniform_names() const override;
     std::string get_uniform_type(const std::string& name) const override;
 
 private:
+    /// Шейдери, надіслані драйверу; статус перевіряється лише після завершення.
+    struct PendingBuild
+    {
+        GLuint program = 0;
+        std::vector<GLuint> shaders;
+        uint64_t cacheKey = 0;
+        bool fromCache = false;
+    };
+
     GLuint m_program = 0;
     std::string m_name;
+    ShaderStatus m_status = ShaderStatus::Failed;
+    std::unique_ptr<PendingBuild> m_pending;
     mutable std::unordered_map<std::string, GLint> m_uniformLocationCache;
     mutable std::unordered_map<std::string, GLenum> m_uniformTypes;
 
-    void compile_from_source(const std::unordered_map<ShaderStageType, std::string>& sources);
-    void compile_from_files(const std::unordered_map<ShaderStageType, std::string>& filePaths);
+    std::unordered_map<uint32_t, GLint> m_uniformsByHash;   ///< Хеш імені -> розташування (з reflect_uniforms)
+    mutable std::vector<uint32_t> m_handleHashes;           ///< Хеш для кожного виданого дескриптора
+    mutable std::vector<GLint> m_handleLocations;           ///< Розташування за індексом дескриптора
+
+    std::unordered_map<ShaderStageType, std::string> m_filePaths;   ///< Шляхи джерел (порожньо для шейдерів з коду)
+    std::vector<std::string> m_includes;                            ///< Файли, підключені через #include
+    std::vector<WatchId> m_watches;                                 ///< Підписки FileWatcher для гарячого перезавантаження
+    size_t m_watchedIncludes = 0;                                   ///< Скільки перших m_includes уже мають підписку
+
+    GLuint compile_from_source(const std::unordered_map<ShaderStageType, std::string>& sources);
+    GLuint compile_from_files(const std::unordered_map<ShaderStageType, std::string>& filePaths);
+    GLuint compile_stages(const std::unordered_map<ShaderStageType, std::string_view>& sources);
+    bool read_files(const std::unordered_map<ShaderStageType, std::string>& filePaths,
+        std::vector<std::string>& storage, std::unordered_map<ShaderStageType, std::string_view>& sources);
+
+    PendingBuild submit_stages(const std::unordered_map<ShaderStageType, std::string_view>& sources);
+    bool is_build_complete(const PendingBuild& build) const;
+    GLuint finish_build(PendingBuild& build);
+    void complete_pending();
+    void resolve_handles();
     
-    GLuint compile_shader(GLenum type, const std::string& source);
-    void check_compile_errors(GLuint shader, const std::string& type);
+    GLuint compile_shader(GLenum type, std::string_view source);
+    bool check_compile_errors(GLuint shader, const std::string& type);
     void reflect_uniforms();
+    void bind_uniform_blocks();
+    void watch_files();
+    /// Підписується на файли, що з'явилися в m_includes після останнього виклику.
+    void watch_new_includes();
+    void watch_file(const std::string& path);
     
     GLint get_uniform_location(const std::string& name) const;
+    GLint get_uniform_location(UniformHandle handle) const
+    {
+        return handle.index < m_handleLocations.size() ? m_handleLocations[handle.index] : -1;
+    }
+    GLint find_uniform_location(uint32_t hash) const;
     GLenum shader_stage_to_gl(ShaderStageType type);
 };
\ No newline at end of file
@@ -0,0 +1,135 @@
+#include "EverEngineCore/rendering/shader/API/OpenGL/OpenGLStageProgram.h"
+#include "EverEngineCore/rendering/shader/API/OpenGL/OpenGLPipelineCache.h"
+#include "EverEngineCore/rendering/renderer/API/OpenGL/OpenGLState.h"
+#include "EverEngineCore/rendering/buffers/UniformBuffer.h"
+#include "EverEngineCore/core/Log.h"
+
+namespace
+{
+    GLenum stage_to_gl(ShaderStageType stage)
+    {
+        switch (stage)
+        {
+            case ShaderStageType::Vertex:     return GL_VERTEX_SHADER;
+            case ShaderStageType::Fragment:   return GL_FRAGMENT_SHADER;
+            case ShaderStageType::Geometry:   return GL_GEOMETRY_SHADER;
+            case ShaderStageType::Compute:    return GL_COMPUTE_SHADER;
+            case ShaderStageType::TessEval:   return GL_TESS_EVALUATION_SHADER;
+            case ShaderStageType::TessControl: return GL_TESS_CONTROL_SHADER;
+        }
+        return 0;
+    }
+}
+
+OpenGLStageProgram::OpenGLStageProgram(const std::string& name, ShaderStageType stage, std::string_view source)
+    : m_name(name), m_stage(stage)
+{
+    if (!GLAD_GL_VERSION_4_1)
+    {
+        LOG_ERROR("ERROR::SHADER_STAGE::SEPARATE_PROGRAMS_UNSUPPORTED '{}'", m_name);
+        return;
+    }
+
+    // glCreateShaderProgramv компілює та лінкує стадію з GL_PROGRAM_SEPARABLE
+    std::string text(source);
+    const char* src = text.c_str();
+    GLuint program = glCreateShaderProgramv(stage_to_gl(stage), 1, &src);
+
+    GLint linked = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &linked);
+    if (linked != GL_TRUE)
+    {
+        char infoLog[1024];
+        glGetProgramInfoLog(program, sizeof(infoLog), nullptr, infoLog);
+        LOG_ERROR("Shader stage '{}' build error: {}", m_name, infoLog);
+        glDeleteProgram(program);
+        return;
+    }
+
+    m_program = program;
+    reflect_uniforms();
+    LOG_INFO("Shader stage '{}' compiled successfully (ID: {})", m_name, m_program);
+}
+
+OpenGLStageProgram::~OpenGLStageProgram()
+{
+    if (m_program != 0)
+    {
+        OpenGLPipelineCache::onStageDeleted(m_program);
+        OpenGLState::onProgramDeleted(m_program);
+        glDeleteProgram(m_program);
+        m_program = 0;
+    }
+}
+
+void OpenGLStageProgram::reflect_uniforms()
+{
+    GLint count = 0;
+    glGetProgramiv(m_program, GL_ACTIVE_UNIFORMS, &count);
+
+    for (GLint i = 0; i < count; i++)
+    {
+        char name[256];
+        GLsizei length;
+        GLint size;
+        GLenum type;
+        glGetActiveUniform(m_program, i, sizeof(name), &length, &size, &type, name);
+
+        GLint location = glGetUniformLocation(m_program, name);
+        if (location == -1) continue;
+
+        m_uniforms[name] = location;
+        m_uniformTypes[name] = type;
+
+        std::string_view key(name, length);
+        if (key.size() > 3 && key.ends_with("[0]")) key.remove_suffix(3);
+        m_uniformsByHash.emplace(Hash::fnv1a32(key), location);
+    }
+
+    GLint blocks = 0;
+    glGetProgramiv(m_program, GL_ACTIVE_UNIFORM_BLOCKS, &blocks);
+    for (GLint i = 0; i < blocks; i++)
+    {
+        char name[256];
+        GLsizei length = 0;
+        glGetActiveUniformBlockName(m_program, static_cast<GLuint>(i), sizeof(name), &length, name);
+
+        uint32_t binding = 0;
+        if (UniformBuffer::find_block_binding(std::string_view(name, length), binding))
+            glUniformBlockBinding(m_program, static_cast<GLuint>(i), binding);
+        else
+            LOG_WARN("Uniform block '{}' in shader stage '{}' has no registered binding", name, m_name);
+    }
+}
+
+GLint OpenGLStageProgram::find_location(uint32_t hash) const
+{
+    auto it = m_uniformsByHash.find(hash);
+    return it != m_uniformsByHash.end() ? it->second : -1;
+}
+
+GLint OpenGLStageProgram::find_location(const std::string& name) const
+{
+    auto it = m_uniforms.find(name);
+    return it != m_uniforms.end() ? it->second : -1;
+}
+
+GLenum OpenGLStageProgram::find_type(const std::string& name) const
+{
+    auto it = m_uniformTypes.find(name);
+    return it != m_uniformTypes.end() ? it->second : 0;
+}
+
+GLbitfield OpenGLStageProgram::get_stage_bit() const
+{
+    switch (m_stage)
+    {
+        case ShaderStageType::Vertex:     return GL_VERTEX_SHADER_BIT;
+        case ShaderStageType::Fragment:   return GL_FRAGMENT_SHADER_BIT;
+        case ShaderStageType::Geometry:   return GL_GEOMETRY_SHADER_BIT;
+        case ShaderStageType::Compute:    return GL_COMPUTE_SHADER_BIT;
+        case ShaderStageType::TessEval:   return GL_TESS_EVALUATION_SHADER_BIT;
+        case ShaderStageType::TessControl: return GL_TESS_CONTROL_SHADER_BIT;
+    }
+    return 0;
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <glad/glad.h>
+
+#include "EverEngineCore/rendering/shader/ShaderStageProgram.h"
+
+class OpenGLStageProgram : public ShaderStageProgram
+{
+public:
+    OpenGLStageProgram(const std::string& name, ShaderStageType stage, std::string_view source);
+    virtual ~OpenGLStageProgram();
+
+    bool is_valid() const override { return m_program != 0; }
+    uint32_t get_id() const override { return m_program; }
+    ShaderStageType get_stage() const override { return m_stage; }
+    const std::string& get_name() const override { return m_name; }
+
+    /// Розташування за FNV-1a хешем імені (-1, якщо змінної в стадії немає).
+    GLint find_location(uint32_t hash) const;
+    GLint find_location(const std::string& name) const;
+    GLenum find_type(const std::string& name) const;
+
+    const std::unordered_map<std::string, GLint>& get_uniforms() const { return m_uniforms; }
+
+    /// Біт стадії для glUseProgramStages.
+    GLbitfield get_stage_bit() const;
+private:
+    GLuint m_program = 0;
+    std::string m_name;
+    ShaderStageType m_stage;
+
+    std::unordered_map<std::string, GLint> m_uniforms;
+    std::unordered_map<std::string, GLenum> m_uniformTypes;
+    std::unordered_map<uint32_t, GLint> m_uniformsByHash;
+
+    void reflect_uniforms();
+};
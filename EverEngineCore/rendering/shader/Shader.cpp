@@ -1,5 +1,6 @@
 #include "EverEngineCore/rendering/shader/Shader.h"
 #include "EverEngineCore/rendering/shader/API/OpenGL/OpenGLShader.h"
+#include "EverEngineCore/rendering/shader/API/OpenGL/OpenGLPipelineShader.h"
 #include "EverEngineCore/core/Log.h"
 
 std::shared_ptr<Shader> Shader::create_from_files(
@@ -14,4 +15,25 @@ std::shared_ptr<Shader> Shader::create_from_source(
     const std::unordered_map<ShaderStageType, std::string>& sources)
 {
     return std::make_shared<OpenGLShader>(name, sources);
-}
\ No newline at end of file
+}
+
+std::shared_ptr<Shader> Shader::create_from_files_async(
+    const std::string& name,
+    const std::unordered_map<ShaderStageType, std::string>& filePaths)
+{
+    return std::make_shared<OpenGLShader>(name, filePaths, true, true);
+}
+
+std::shared_ptr<Shader> Shader::create_from_source_async(
+    const std::string& name,
+    const std::unordered_map<ShaderStageType, std::string>& sources)
+{
+    return std::make_shared<OpenGLShader>(name, sources, false, true);
+}
+
+std::shared_ptr<Shader> Shader::create_from_stages(
+    const std::string& name,
+    std::vector<std::shared_ptr<ShaderStageProgram>> stages)
+{
+    return std::make_shared<OpenGLPipelineShader>(name, std::move(stages));
+}
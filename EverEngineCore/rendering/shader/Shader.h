@@ -4,6 +4,9 @@
 #include <vector>
 #include <memory>
 #include <unordered_map>
+#include <string_view>
+
+#include "EverEngineCore/core/Hash.h"
 
 enum class ShaderStageType
 {
@@ -15,6 +18,48 @@ enum class ShaderStageType
     TessControl
 };
 
+/**
+ * @brief Стан збірки шейдера.
+ */
+enum class ShaderStatus
+{
+    Compiling,  ///< Асинхронна збірка ще триває
+    Ready,
+    Failed
+};
+
+/**
+ * @brief Ідентифікатор uniform-змінної - FNV-1a хеш імені, обчислений під час компіляції.
+ *
+ * @code
+ * constexpr UniformId k_model("u_Model");
+ * @endcode
+ */
+struct UniformId
+{
+    uint32_t hash = 0;
+
+    constexpr UniformId() = default;
+    constexpr explicit UniformId(std::string_view name) : hash(Hash::fnv1a32(name)) {}
+};
+
+/**
+ * @brief Індекс uniform-змінної в пласкому масиві розташувань шейдера.
+ *
+ * Отримується один раз через Shader::get_uniform_handle і лишається дійсним
+ * після перезавантаження шейдера. Для змінної, якої немає в програмі,
+ * повертається дійсний дескриптор із розташуванням -1 - GL ігнорує такі виклики.
+ */
+struct UniformHandle
+{
+    static constexpr uint32_t k_invalid = ~0u;
+    uint32_t index = k_invalid;
+
+    bool is_valid() const { return index != k_invalid; }
+};
+
+class ShaderStageProgram;
+
 class Shader
 {
 public:
@@ -27,6 +72,23 @@ public:
     virtual uint32_t get_id() const = 0;
     virtual const std::string& get_name() const = 0;
 
+    /// Перекомпільовує шейдер з файлів; попередня програма лишається, якщо збірка невдала.
+    virtual bool reload() = 0;
+
+    /**
+     * @brief Перевіряє стан збірки, не блокуючи потік.
+     *
+     * Для асинхронного шейдера завершує збірку, щойно драйвер її закінчив.
+     * Поки стан Compiling, bind() прив'язує порожню програму - об'єкт просто не малюється.
+     */
+    virtual ShaderStatus get_status() = 0;
+
+    /**
+     * @brief Чекає на завершення збірки.
+     * @return true, якщо шейдер готовий.
+     */
+    virtual bool wait() = 0;
+
     virtual void set_bool(const std::string& name, bool value) = 0;
     virtual void set_int(const std::string& name, int value) = 0;
     virtual void set_int_array(const std::string& name, int* values, uint32_t count) = 0;
@@ -40,6 +102,21 @@ public:
     virtual void set_mat3(const std::string& name, const float* value) = 0;
     virtual void set_mat4(const std::string& name, const float* value) = 0;
 
+    /**
+     * @brief Знаходить дескриптор змінної; викликається при ініціалізації, а не щокадру.
+     */
+    virtual UniformHandle get_uniform_handle(UniformId id) const = 0;
+
+    // Встановлення через дескриптор: лише читання з масиву та виклик GL, без рядків і хеш-таблиць
+    virtual void set_int(UniformHandle handle, int value) = 0;
+    virtual void set_int_array(UniformHandle handle, const int* values, uint32_t count) = 0;
+    virtual void set_float(UniformHandle handle, float value) = 0;
+    virtual void set_float2(UniformHandle handle, float x, float y) = 0;
+    virtual void set_float3(UniformHandle handle, float x, float y, float z) = 0;
+    virtual void set_float4(UniformHandle handle, float x, float y, float z, float w) = 0;
+    virtual void set_mat3(UniformHandle handle, const float* value) = 0;
+    virtual void set_mat4(UniformHandle handle, const float* value) = 0;
+
     virtual std::vector<std::string> get_uniform_names() const = 0;
     virtual std::string get_uniform_type(const std::string& name) const = 0;
     
@@ -53,4 +130,32 @@ public:
         const std::string& name,
         const std::unordered_map<ShaderStageType, std::string>& sources
     );
+
+    /**
+     * @brief Запускає збірку і повертається одразу, не чекаючи на драйвер.
+     *
+     * Зручно для екранів завантаження: спершу створюються всі шейдери, а
+     * потім щокадру перевіряється get_status(). Компіляція йде паралельно,
+     * якщо драйвер підтримує GL_KHR_parallel_shader_compile; без нього
+     * збірка завершується при першому get_status().
+     */
+    static std::shared_ptr<Shader> create_from_files_async(
+        const std::string& name,
+        const std::unordered_map<ShaderStageType, std::string>& filePaths
+    );
+
+    static std::shared_ptr<Shader> create_from_source_async(
+        const std::string& name,
+        const std::unordered_map<ShaderStageType, std::string>& sources
+    );
+
+    /**
+     * @brief Складає шейдер з окремо скомпільованих стадій без лінкування.
+     *
+     * Конвеєр для того самого набору стадій береться з кешу. Потребує GL 4.1.
+     */
+    static std::shared_ptr<Shader> create_from_stages(
+        const std::string& name,
+        std::vector<std::shared_ptr<ShaderStageProgram>> stages
+    );
 };
\ No newline at end of file
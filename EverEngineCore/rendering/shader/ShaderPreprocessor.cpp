@@ -0,0 +1,262 @@
+#include "EverEngineCore/rendering/shader/ShaderPreprocessor.h"
+#include "EverEngineCore/platform/filesystem/VirtualFileSystem.h"
+#include "EverEngineCore/platform/filesystem/FileSystem.h"
+#include "EverEngineCore/core/Hash.h"
+#include "EverEngineCore/core/Log.h"
+
+#include <algorithm>
+#include <vector>
+#include <unordered_set>
+
+namespace
+{
+    constexpr uint32_t k_maxIncludeDepth = 32;
+
+    struct Context
+    {
+        PreprocessedShader* out;
+        std::unordered_set<std::string> onceFiles;  ///< Файли з #pragma once, що вже підключені
+    };
+
+    std::string_view trim_left(std::string_view line)
+    {
+        size_t start = line.find_first_not_of(" \t");
+        return start == std::string_view::npos ? std::string_view{} : line.substr(start);
+    }
+
+    /// Розбирає "#<directive>", допускаючи пробіли після '#'; повертає решту рядка.
+    bool match_directive(std::string_view line, std::string_view directive, std::string_view& rest)
+    {
+        line = trim_left(line);
+        if (line.empty() || line.front() != '#') return false;
+
+        line = trim_left(line.substr(1));
+        if (!line.starts_with(directive)) return false;
+
+        rest = line.substr(directive.size());
+        return rest.empty() || rest.front() == ' ' || rest.front() == '\t' ||
+            rest.front() == '"' || rest.front() == '<' || rest.front() == '\r';
+    }
+
+    bool parse_include_path(std::string_view rest, std::string_view& path)
+    {
+        rest = trim_left(rest);
+        if (rest.empty()) return false;
+
+        char close = rest.front() == '"' ? '"' : rest.front() == '<' ? '>' : 0;
+        if (!close) return false;
+
+        size_t end = rest.find(close, 1);
+        if (end == std::string_view::npos) return false;
+
+        path = rest.substr(1, end - 1);
+        return !path.empty();
+    }
+
+    bool has_pragma_once(std::string_view source)
+    {
+        size_t position = 0;
+        while (position < source.size())
+        {
+            size_t end = source.find('\n', position);
+            if (end == std::string_view::npos) end = source.size();
+
+            std::string_view rest;
+            if (match_directive(source.substr(position, end - position), "pragma", rest) &&
+                trim_left(rest).starts_with("once"))
+                return true;
+
+            position = end + 1;
+        }
+        return false;
+    }
+
+    /// Чи є першою значущою директивою #version: GLSL дозволяє перед нею порожні рядки та коментарі.
+    bool starts_with_version(std::string_view source)
+    {
+        size_t position = 0;
+        while (position < source.size())
+        {
+            position = source.find_first_not_of(" \t\r\n", position);
+            if (position == std::string_view::npos) return false;
+
+            std::string_view rest = source.substr(position);
+            if (rest.starts_with("//"))
+            {
+                position = source.find('\n', position);
+                if (position == std::string_view::npos) return false;
+            }
+            else if (rest.starts_with("/*"))
+            {
+                position = source.find("*/", position + 2);
+                if (position == std::string_view::npos) return false;
+                position += 2;
+            }
+            else
+            {
+                std::string_view directive;
+                return match_directive(rest.substr(0, rest.find('\n')), "version", directive);
+            }
+        }
+        return false;
+    }
+
+    /// Згортає "." та ".." - нормалізація VFS їх не обробляє, а include часто виходять на рівень вище.
+    std::string collapse_dots(std::string_view path)
+    {
+        std::vector<std::string_view> parts;
+        size_t position = 0;
+        while (position <= path.size())
+        {
+            size_t end = path.find('/', position);
+            if (end == std::string_view::npos) end = path.size();
+            std::string_view part = path.substr(position, end - position);
+            position = end + 1;
+
+            if (part.empty() || part == ".") continue;
+            if (part == ".." && !parts.empty() && parts.back() != "..") parts.pop_back();
+            else parts.push_back(part);
+        }
+
+        std::string result;
+        for (std::string_view part : parts)
+        {
+            if (!result.empty()) result += '/';
+            result.append(part);
+        }
+        return result;
+    }
+
+    bool resolve_include(std::string_view from, std::string_view include, std::string& resolved, VirtualFile& file)
+    {
+        if (!from.empty())
+        {
+            resolved = collapse_dots(VirtualFileSystem::normalize(Path::join(Path::getDirectory(from), include)));
+            if (VirtualFileSystem::open(resolved, file)) return true;
+        }
+
+        resolved = collapse_dots(VirtualFileSystem::normalize(include));
+        return VirtualFileSystem::open(resolved, file);
+    }
+
+    uint32_t source_index(Context& context, const std::string& path)
+    {
+        auto& includes = context.out->includes;
+        auto it = std::find(includes.begin(), includes.end(), path);
+        if (it != includes.end()) return static_cast<uint32_t>(it - includes.begin()) + 1;
+
+        includes.push_back(path);
+        return static_cast<uint32_t>(includes.size());
+    }
+
+    bool expand(Context& context, std::string_view source, std::string_view path, uint32_t sourceIndex,
+        uint32_t depth, const std::vector<ShaderDefine>* defines)
+    {
+        std::string& out = context.out->source;
+        uint32_t lineNumber = 0;
+        size_t position = 0;
+
+        // Без #version визначення йдуть на самий початок
+        bool pendingDefines = defines && !defines->empty();
+        if (pendingDefines)
+        {
+            if (!starts_with_version(source))
+            {
+                for (const auto& define : *defines) out += "#define " + define.name + " " + define.value + "\n";
+                out += "#line 1 " + std::to_string(sourceIndex) + "\n";
+                pendingDefines = false;
+            }
+        }
+
+        while (position < source.size())
+        {
+            size_t end = source.find('\n', position);
+            if (end == std::string_view::npos) end = source.size();
+            std::string_view line = source.substr(position, end - position);
+            position = end + 1;
+            lineNumber++;
+
+            std::string_view rest;
+            if (match_directive(line, "include", rest))
+            {
+                std::string_view includePath;
+                if (!parse_include_path(rest, includePath))
+                {
+                    LOG_ERROR("ERROR::SHADER_PREPROCESSOR::BAD_INCLUDE ({}:{})", path, lineNumber);
+                    return false;
+                }
+                if (depth + 1 >= k_maxIncludeDepth)
+                {
+                    LOG_ERROR("ERROR::SHADER_PREPROCESSOR::INCLUDE_TOO_DEEP ({}:{})", path, lineNumber);
+                    return false;
+                }
+
+                std::string resolved;
+                VirtualFile file;
+                if (!resolve_include(path, includePath, resolved, file))
+                {
+                    LOG_ERROR("ERROR::SHADER_PREPROCESSOR::INCLUDE_NOT_FOUND '{}' ({}:{})", includePath, path, lineNumber);
+                    return false;
+                }
+
+                std::string_view text = file.text();
+                if (has_pragma_once(text) && !context.onceFiles.insert(resolved).second)
+                {
+                    out += '\n';    // Зберігає нумерацію рядків
+                    continue;
+                }
+
+                uint32_t index = source_index(context, resolved);
+                out += "#line 1 " + std::to_string(index) + "\n";
+                if (!expand(context, text, resolved, index, depth + 1, nullptr)) return false;
+                if (!out.empty() && out.back() != '\n') out += '\n';
+                out += "#line " + std::to_string(lineNumber + 1) + " " + std::to_string(sourceIndex) + "\n";
+                continue;
+            }
+
+            if (match_directive(line, "pragma", rest) && trim_left(rest).starts_with("once"))
+            {
+                out += '\n';
+                continue;
+            }
+
+            out.append(line);
+            out += '\n';
+
+            if (pendingDefines && match_directive(line, "version", rest))
+            {
+                for (const auto& define : *defines) out += "#define " + define.name + " " + define.value + "\n";
+                out += "#line " + std::to_string(lineNumber + 1) + " " + std::to_string(sourceIndex) + "\n";
+                pendingDefines = false;
+            }
+        }
+        return true;
+    }
+}
+
+bool ShaderPreprocessor::process(std::string_view source, std::string_view path,
+    const std::vector<ShaderDefine>& defines, PreprocessedShader& out)
+{
+    out = {};
+    out.source.reserve(source.size() + 64 * defines.size());
+
+    Context context{ &out, {} };
+    std::string normalized = VirtualFileSystem::normalize(path);
+    if (!normalized.empty() && has_pragma_once(source)) context.onceFiles.insert(normalized);
+
+    if (!expand(context, source, normalized, 0, 0, &defines)) return false;
+
+    out.hash = Hash::xxh64(out.source.data(), out.source.size());
+    return true;
+}
+
+bool ShaderPreprocessor::processFile(std::string_view path, const std::vector<ShaderDefine>& defines, PreprocessedShader& out)
+{
+    VirtualFile file;
+    if (!VirtualFileSystem::open(path, file))
+    {
+        LOG_ERROR("ERROR::SHADER_PREPROCESSOR::FILE_NOT_FOUND '{}'", path);
+        return false;
+    }
+    return process(file.text(), path, defines, out);
+}
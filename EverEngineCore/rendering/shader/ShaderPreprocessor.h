@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief Визначення, що підставляється у шейдер як "#define name value".
+ */
+struct ShaderDefine
+{
+    std::string name;
+    std::string value = "1";
+};
+
+/**
+ * @brief Результат препроцесора.
+ */
+struct PreprocessedShader
+{
+    std::string source;
+    std::vector<std::string> includes;  ///< Підключені файли; індекс + 1 - номер джерела в #line
+    uint64_t hash = 0;                  ///< XXH64 тексту після обробки
+};
+
+/**
+ * @brief Препроцесор GLSL рушія: #include та підстановка визначень.
+ *
+ * #include "path" шукає файл спершу відносно файлу, що його підключає, а
+ * потім від кореня VirtualFileSystem. Файл із "#pragma once" підключається
+ * лише раз; глибина вкладення обмежена, тож цикл дає помилку, а не
+ * нескінченну рекурсію. Визначення вставляються одразу після #version
+ * (він має лишатися першим рядком). Після кожного підключення ставиться
+ * #line, тож номери рядків у журналі компілятора вказують на вихідний файл:
+ * джерело 0 - основний файл, N - includes[N - 1].
+ *
+ * Решта директив (#if, #ifdef...) лишається компілятору GLSL.
+ *
+ * @code
+ * PreprocessedShader result;
+ * ShaderPreprocessor::processFile("shaders/lit.frag", { { "SKINNED" } }, result);
+ * @endcode
+ */
+class ShaderPreprocessor
+{
+public:
+    /**
+     * @brief Обробляє текст шейдера.
+     * @param path Віртуальний шлях тексту (для відносних #include); може бути порожнім.
+     * @return false, якщо підключений файл не знайдено або вкладення занадто глибоке.
+     */
+    static bool process(std::string_view source, std::string_view path,
+        const std::vector<ShaderDefine>& defines, PreprocessedShader& out);
+
+    /**
+     * @brief Читає файл через VirtualFileSystem та обробляє його.
+     */
+    static bool processFile(std::string_view path, const std::vector<ShaderDefine>& defines, PreprocessedShader& out);
+};
@@ -0,0 +1,21 @@
+#include "EverEngineCore/rendering/shader/ShaderStageProgram.h"
+#include "EverEngineCore/rendering/shader/API/OpenGL/OpenGLStageProgram.h"
+#include "EverEngineCore/core/Log.h"
+
+std::shared_ptr<ShaderStageProgram> ShaderStageProgram::create_from_file(const std::string& path, ShaderStageType stage,
+    const std::vector<ShaderDefine>& defines)
+{
+    PreprocessedShader result;
+    if (!ShaderPreprocessor::processFile(path, defines, result))
+    {
+        LOG_ERROR("ERROR::SHADER_STAGE::PREPROCESS '{}'", path);
+        return nullptr;
+    }
+    return std::make_shared<OpenGLStageProgram>(path, stage, result.source);
+}
+
+std::shared_ptr<ShaderStageProgram> ShaderStageProgram::create_from_source(const std::string& name, ShaderStageType stage,
+    const std::string& source)
+{
+    return std::make_shared<OpenGLStageProgram>(name, stage, source);
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "EverEngineCore/rendering/shader/Shader.h"
+#include "EverEngineCore/rendering/shader/ShaderPreprocessor.h"
+
+/**
+ * @brief Одна стадія шейдера, скомпільована як окрема (separable) програма.
+ *
+ * Стадії компілюються незалежно й комбінуються через Shader::create_from_stages
+ * без повторного лінкування: для N вершинних і M фрагментних шейдерів
+ * потрібно N + M компіляцій замість N * M лінкувань. Інтерфейси стадій
+ * (out/in змінні) мають збігатися за location або за іменем і типом.
+ *
+ * Вершинна стадія має оголосити out gl_PerVertex { vec4 gl_Position; },
+ * якщо її версія GLSL цього вимагає.
+ */
+class ShaderStageProgram
+{
+public:
+    virtual ~ShaderStageProgram() = default;
+
+    virtual bool is_valid() const = 0;
+    virtual uint32_t get_id() const = 0;
+    virtual ShaderStageType get_stage() const = 0;
+    virtual const std::string& get_name() const = 0;
+
+    /**
+     * @brief Компілює стадію з файлу (з обробкою #include та визначень).
+     */
+    static std::shared_ptr<ShaderStageProgram> create_from_file(const std::string& path, ShaderStageType stage,
+        const std::vector<ShaderDefine>& defines = {});
+
+    static std::shared_ptr<ShaderStageProgram> create_from_source(const std::string& name, ShaderStageType stage,
+        const std::string& source);
+};
@@ -0,0 +1,126 @@
+#include "EverEngineCore/rendering/shader/ShaderVariants.h"
+#include "EverEngineCore/core/Log.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace
+{
+    bool is_identifier_char(char c)
+    {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+    }
+
+    /// Шукає слово як окремий ідентифікатор, а не частину іншого (LIT у LIT_FOG).
+    bool contains_identifier(std::string_view text, std::string_view word)
+    {
+        for (size_t position = text.find(word); position != std::string_view::npos; position = text.find(word, position + 1))
+        {
+            size_t end = position + word.size();
+            bool startsToken = position == 0 || !is_identifier_char(text[position - 1]);
+            bool endsToken = end == text.size() || !is_identifier_char(text[end]);
+            if (startsToken && endsToken) return true;
+        }
+        return false;
+    }
+}
+
+ShaderVariants::ShaderVariants(std::string name,
+    std::unordered_map<ShaderStageType, std::string> filePaths,
+    std::vector<std::string> keywords,
+    std::vector<ShaderDefine> defines)
+    : m_name(std::move(name)), m_filePaths(std::move(filePaths)), m_keywords(std::move(keywords)), m_defines(std::move(defines))
+{
+    if (m_keywords.size() > k_maxKeywords)
+    {
+        LOG_ERROR("ERROR::SHADER_VARIANTS::TOO_MANY_KEYWORDS '{}' ({})", m_name, m_keywords.size());
+        m_keywords.resize(k_maxKeywords);
+    }
+}
+
+uint64_t ShaderVariants::get_mask(std::initializer_list<std::string_view> keywords) const
+{
+    uint64_t mask = 0;
+    for (std::string_view keyword : keywords)
+    {
+        auto it = std::find(m_keywords.begin(), m_keywords.end(), keyword);
+        if (it == m_keywords.end())
+        {
+            LOG_WARN("WARN::SHADER_VARIANTS::UNKNOWN_KEYWORD '{}' in '{}'", keyword, m_name);
+            continue;
+        }
+        mask |= 1ull << (it - m_keywords.begin());
+    }
+    return mask;
+}
+
+std::shared_ptr<Shader> ShaderVariants::get(uint64_t mask)
+{
+    auto cached = m_variants.find(mask);
+    if (cached != m_variants.end()) return cached->second;
+
+    // Слова, яких немає в шейдері, не змінюють програму
+    uint64_t effective = mask & get_used_mask();
+    if (effective != mask)
+    {
+        std::shared_ptr<Shader> shader = get(effective);
+        m_variants[mask] = shader;
+        return shader;
+    }
+
+    std::vector<ShaderDefine> defines = m_defines;
+    for (size_t bit = 0; bit < m_keywords.size(); bit++)
+    {
+        if (mask & (1ull << bit)) defines.push_back({ m_keywords[bit], "1" });
+    }
+
+    std::unordered_map<ShaderStageType, std::string> sources;
+    for (const auto& [stage, path] : m_filePaths)
+    {
+        PreprocessedShader result;
+        if (!ShaderPreprocessor::processFile(path, defines, result))
+        {
+            LOG_ERROR("ERROR::SHADER_VARIANTS::PREPROCESS '{}' (mask {:#x})", m_name, mask);
+            m_variants[mask] = nullptr;
+            return nullptr;
+        }
+        sources[stage] = std::move(result.source);
+    }
+
+    std::shared_ptr<Shader> shader = Shader::create_from_source(m_name + "#" + std::to_string(mask), sources);
+    if (!shader->is_valid()) shader = nullptr;
+
+    m_variants[mask] = shader;
+    return shader;
+}
+
+uint64_t ShaderVariants::get_used_mask()
+{
+    if (m_usedMaskValid) return m_usedMask;
+
+    // Препроцесор не обчислює #if, тож розгорнутий без ключових слів текст містить усі гілки
+    uint64_t used = 0;
+    for (const auto& [stage, path] : m_filePaths)
+    {
+        PreprocessedShader result;
+        if (!ShaderPreprocessor::processFile(path, m_defines, result))
+        {
+            // Без тексту не відкидаємо жодного біта; помилку повідомить get()
+            return ~0ull;
+        }
+        for (size_t bit = 0; bit < m_keywords.size(); bit++)
+        {
+            if (contains_identifier(result.source, m_keywords[bit])) used |= 1ull << bit;
+        }
+    }
+
+    m_usedMask = used;
+    m_usedMaskValid = true;
+    return m_usedMask;
+}
+
+void ShaderVariants::clear()
+{
+    m_variants.clear();
+    m_usedMaskValid = false;
+}
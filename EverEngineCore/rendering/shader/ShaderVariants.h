@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "EverEngineCore/rendering/shader/Shader.h"
+#include "EverEngineCore/rendering/shader/ShaderPreprocessor.h"
+
+/**
+ * @brief Набір варіантів одного шейдера, що відрізняються ключовими словами.
+ *
+ * Кожне ключове слово (SKINNED, LIT...) - біт маски; варіант для маски
+ * компілюється при першому запиті з "#define <KEYWORD> 1" для ввімкнених
+ * бітів і кешується за маскою. При першому запиті тексти стадій один раз
+ * розгортаються без ключових слів і в них шукаються їхні імена: біти слів,
+ * яких у шейдері немає, відкидаються з маски, тож маски з ними і без них
+ * отримують ту саму програму. Між запусками незмінний текст бере бінарник
+ * з кешу програм.
+ *
+ * @code
+ * ShaderVariants lit("Lit", { { ShaderStageType::Vertex, "shaders/lit.vert" },
+ *                             { ShaderStageType::Fragment, "shaders/lit.frag" } },
+ *                    { "SKINNED", "UNLIT" });
+ * auto shader = lit.get(lit.get_mask({ "SKINNED" }));
+ * @endcode
+ */
+class ShaderVariants
+{
+public:
+    static constexpr uint32_t k_maxKeywords = 64;
+
+    /**
+     * @param filePaths Віртуальні шляхи стадій.
+     * @param keywords Ключові слова; порядок задає біти маски.
+     * @param defines Визначення, спільні для всіх варіантів.
+     */
+    ShaderVariants(std::string name,
+        std::unordered_map<ShaderStageType, std::string> filePaths,
+        std::vector<std::string> keywords,
+        std::vector<ShaderDefine> defines = {});
+
+    /**
+     * @brief Будує маску з ключових слів; невідомі слова ігноруються з попередженням.
+     */
+    uint64_t get_mask(std::initializer_list<std::string_view> keywords) const;
+
+    /**
+     * @brief Повертає варіант, компілюючи його при першому запиті.
+     * @return nullptr, якщо препроцесор чи компіляція завершились помилкою.
+     */
+    std::shared_ptr<Shader> get(uint64_t mask);
+
+    /// Маска ключових слів, що трапляються в текстах стадій (після #include).
+    uint64_t get_used_mask();
+
+    /**
+     * @brief Скидає всі варіанти (наприклад, після зміни файлів).
+     */
+    void clear();
+
+    size_t get_variant_count() const { return m_variants.size(); }
+    const std::vector<std::string>& get_keywords() const { return m_keywords; }
+private:
+    std::string m_name;
+    std::unordered_map<ShaderStageType, std::string> m_filePaths;
+    std::vector<std::string> m_keywords;
+    std::vector<ShaderDefine> m_defines;
+
+    std::unordered_map<uint64_t, std::shared_ptr<Shader>> m_variants;   ///< Маска -> програма
+    uint64_t m_usedMask = 0;
+    bool m_usedMaskValid = false;
+};
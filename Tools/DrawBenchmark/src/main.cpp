@@ -0,0 +1,203 @@
+#include <EverEngineCore/core/Engine.h>
+#include <EverEngineCore/rendering/renderer/Renderer.h>
+#include <EverEngineCore/rendering/buffers/IndirectBuffer.h>
+#include <EverEngineCore/rendering/shader/Shader.h>
+#include <glad/glad.h>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+
+/**
+ * Порівнює звичайний шлях (uniform + draw на кожен меш) з одним
+ * glMultiDrawElementsIndirect для тієї самої сітки квадратів.
+ * Режими чергуються блоками кадрів; після кожної пари блоків друкується
+ * середній час подання на CPU і час до завершення роботи GPU (glFinish).
+ */
+
+static const char* k_directVertex = R"(
+#version 330 core
+layout(location = 0) in vec2 a_Position;
+uniform vec4 u_Transform;
+void main() { gl_Position = vec4(a_Position * u_Transform.z + u_Transform.xy, 0.0, 1.0); }
+)";
+
+// gl_DrawID є в ядрі GLSL 4.60; на GL 4.3-4.5 його дає GL_ARB_shader_draw_parameters
+static const char* k_indirectHeader460 = "#version 460 core\n#define DRAW_ID gl_DrawID\n";
+static const char* k_indirectHeaderARB =
+    "#version 430 core\n#extension GL_ARB_shader_draw_parameters : require\n#define DRAW_ID gl_DrawIDARB\n";
+
+static const char* k_indirectVertex = R"(
+layout(location = 0) in vec2 a_Position;
+layout(std430, binding = 0) readonly buffer DrawBuffer { vec4 u_Transforms[]; };
+void main()
+{
+    vec4 transform = u_Transforms[DRAW_ID];
+    gl_Position = vec4(a_Position * transform.z + transform.xy, 0.0, 1.0);
+}
+)";
+
+static const char* k_fragment = R"(
+#version 330 core
+out vec4 o_Color;
+void main() { o_Color = vec4(1.0, 0.8, 0.2, 1.0); }
+)";
+
+static bool has_extension(const char* name)
+{
+    GLint count = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+    for (GLint i = 0; i < count; i++)
+    {
+        const char* extension = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, static_cast<GLuint>(i)));
+        if (extension && std::strcmp(extension, name) == 0) return true;
+    }
+    return false;
+}
+
+static constexpr uint32_t k_warmupFrames = 30;
+static constexpr uint32_t k_blockFrames = 240;
+
+class DrawBenchmark : public Engine
+{
+public:
+    explicit DrawBenchmark(uint32_t draws) : m_draws(draws) {}
+
+    bool setup()
+    {
+        if (!IndirectBuffer::is_supported())
+        {
+            std::cerr << "Multi-draw indirect requires OpenGL 4.3" << std::endl;
+            return false;
+        }
+
+        const char* indirectHeader = nullptr;
+        if (GLAD_GL_VERSION_4_6) indirectHeader = k_indirectHeader460;
+        else if (has_extension("GL_ARB_shader_draw_parameters")) indirectHeader = k_indirectHeaderARB;
+        else
+        {
+            std::cerr << "gl_DrawID requires OpenGL 4.6 or GL_ARB_shader_draw_parameters" << std::endl;
+            return false;
+        }
+
+        const float vertices[] = { -1.0f, -1.0f, 1.0f, -1.0f, 1.0f, 1.0f, -1.0f, 1.0f };
+        const unsigned int indices[] = { 0, 1, 2, 2, 3, 0 };
+
+        m_vertexArray = VertexArray::create();
+        m_vertexArray->add_vertex_buffer(VertexBuffer::create(vertices, sizeof(vertices)),
+            BufferLayout{ { ShaderDataType::Float2, "a_Position" } });
+        m_vertexArray->set_index_buffer(IndexBuffer::create(indices, 6));
+
+        m_directShader = Shader::create_from_source("BenchDirect",
+            { { ShaderStageType::Vertex, k_directVertex }, { ShaderStageType::Fragment, k_fragment } });
+        m_indirectShader = Shader::create_from_source("BenchIndirect",
+            { { ShaderStageType::Vertex, std::string(indirectHeader) + k_indirectVertex }, { ShaderStageType::Fragment, k_fragment } });
+        if (!m_directShader->is_valid() || !m_indirectShader->is_valid()) return false;
+
+        m_transformHandle = m_directShader->get_uniform_handle(UniformId("u_Transform"));
+        m_commands = IndirectBuffer::create(m_draws, sizeof(float) * 4);
+
+        std::cout << "Benchmarking " << m_draws << " draws per frame" << std::endl;
+        return true;
+    }
+
+    void on_update() override
+    {
+        RendererAPI& api = *Renderer::getAPI();
+        const bool indirect = (m_frame / k_blockFrames) % 2 == 1;
+        const uint32_t side = static_cast<uint32_t>(std::ceil(std::sqrt(static_cast<float>(m_draws))));
+        const float scale = 1.0f / static_cast<float>(side);
+
+        auto start = std::chrono::steady_clock::now();
+        m_vertexArray->bind();
+        if (indirect)
+        {
+            m_indirectShader->bind();
+            m_commands->reset();
+            for (uint32_t i = 0; i < m_draws; i++)
+            {
+                const float transform[4] = { transform_x(i, side, scale), transform_y(i, side, scale), scale * 0.8f, 0.0f };
+                m_commands->add({ 6, 1, 0, 0, 0 }, transform);
+            }
+            api.drawIndirect(*m_vertexArray, DrawMode::Triangles, *m_commands);
+        }
+        else
+        {
+            m_directShader->bind();
+            for (uint32_t i = 0; i < m_draws; i++)
+            {
+                m_directShader->set_float4(m_transformHandle, transform_x(i, side, scale), transform_y(i, side, scale), scale * 0.8f, 0.0f);
+                api.draw(*m_vertexArray, DrawMode::Triangles);
+            }
+        }
+        auto submitted = std::chrono::steady_clock::now();
+        glFinish();
+        auto finished = std::chrono::steady_clock::now();
+
+        if (m_frame >= k_warmupFrames)
+        {
+            Timing& timing = indirect ? m_indirect : m_direct;
+            timing.submit += std::chrono::duration<double, std::milli>(submitted - start).count();
+            timing.total += std::chrono::duration<double, std::milli>(finished - start).count();
+            timing.frames++;
+        }
+
+        m_frame++;
+        if (m_frame % (k_blockFrames * 2) == 0) report();
+    }
+private:
+    struct Timing
+    {
+        double submit = 0.0;
+        double total = 0.0;
+        uint32_t frames = 0;
+    };
+
+    uint32_t m_draws;
+    uint32_t m_frame = 0;
+    Timing m_direct;
+    Timing m_indirect;
+
+    std::shared_ptr<VertexArray> m_vertexArray;
+    std::shared_ptr<Shader> m_directShader;
+    std::shared_ptr<Shader> m_indirectShader;
+    std::shared_ptr<IndirectBuffer> m_commands;
+    UniformHandle m_transformHandle;
+
+    static float transform_x(uint32_t i, uint32_t side, float scale) { return (2.0f * (i % side) + 1.0f) * scale - 1.0f; }
+    static float transform_y(uint32_t i, uint32_t side, float scale) { return (2.0f * (i / side) + 1.0f) * scale - 1.0f; }
+
+    static void print(const char* name, const Timing& timing)
+    {
+        if (timing.frames == 0) return;
+        std::cout << "  " << name << ": submit " << timing.submit / timing.frames
+                  << " ms, submit+gpu " << timing.total / timing.frames << " ms (" << timing.frames << " frames)\n";
+    }
+
+    void report() const
+    {
+        std::cout << "Average per frame:\n";
+        print("per-draw      ", m_direct);
+        print("multi-indirect", m_indirect);
+        std::cout << std::flush;
+    }
+};
+
+int main(int argc, char** argv)
+{
+    uint32_t draws = 10000;
+    if (argc > 1) draws = static_cast<uint32_t>(std::stoul(argv[1]));
+    if (draws == 0)
+    {
+        std::cout << "Usage: drawbench [draws per frame]" << std::endl;
+        return 1;
+    }
+
+    auto benchmark = std::make_unique<DrawBenchmark>(draws);
+    int returnCode = benchmark->init(1024, 720, "Draw benchmark");
+    if (returnCode) return returnCode;
+    if (!benchmark->setup()) return 1;
+    return benchmark->run();
+}
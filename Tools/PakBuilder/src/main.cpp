@@ -0,0 +1,84 @@
+#include <EverEngineCore/platform/filesystem/pak/PakWriter.h>
+#include <EverEngineCore/platform/filesystem/pak/PakArchive.h>
+#include <EverEngineCore/platform/filesystem/FileSystem.h>
+#include <iostream>
+#include <string>
+
+static void print_usage()
+{
+    std::cout << "Usage: pakbuilder <input_dir> <output.pak> [options]\n"
+              << "  --prefix <path>   Prefix for paths inside the archive\n"
+              << "  --no-compress     Store all entries uncompressed\n"
+              << "  --chunk <bytes>   LZ4 chunk size (default 65536)\n"
+              << "  --align <bytes>   Alignment of uncompressed entries (default 16)\n"
+              << "  --verify          Re-open the archive and check every content hash\n";
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 3)
+    {
+        print_usage();
+        return 1;
+    }
+
+    std::string input = argv[1];
+    std::string output = argv[2];
+    std::string prefix;
+    PakWriter::Options options;
+    bool verify = false;
+
+    for (int i = 3; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (arg == "--no-compress")                    options.compress = false;
+        else if (arg == "--verify")                    verify = true;
+        else if (arg == "--prefix" && i + 1 < argc)    prefix = argv[++i];
+        else if (arg == "--chunk" && i + 1 < argc)     options.chunkSize = static_cast<uint32_t>(std::stoul(argv[++i]));
+        else if (arg == "--align" && i + 1 < argc)     options.alignment = static_cast<uint32_t>(std::stoul(argv[++i]));
+        else
+        {
+            print_usage();
+            return 1;
+        }
+    }
+
+    if (!Directory::exists(input))
+    {
+        std::cerr << "Input directory not found: " << input << std::endl;
+        return 1;
+    }
+
+    PakWriter writer(options);
+    size_t count = writer.addDirectory(input, prefix);
+    if (!writer.write(output))
+    {
+        std::cerr << "Failed to write archive: " << output << std::endl;
+        return 1;
+    }
+    std::cout << "Packed " << count << " files into " << output
+              << " (" << File::getSize(output) << " bytes)" << std::endl;
+
+    if (verify)
+    {
+        auto archive = PakArchive::load(output);
+        if (!archive)
+        {
+            std::cerr << "Archive verification failed: cannot open" << std::endl;
+            return 1;
+        }
+
+        std::vector<std::string> entries;
+        archive->list(entries);
+        for (const auto& entry : entries)
+        {
+            if (!archive->verify(entry))
+            {
+                std::cerr << "Archive verification failed: " << entry << std::endl;
+                return 1;
+            }
+        }
+        std::cout << "Verified " << entries.size() << " entries" << std::endl;
+    }
+    return 0;
+}